@@ -19,6 +19,29 @@ std::string const errorMessageLastMajorOrder = R"(
     In order to avoid confusion, such Marrays and Views are not saved directly to HDF5.
     Consider copying to an Marray in FirstMajorOrder or a one-dimensional Marray)";
 
+// 16-bit floating point types, derived from IEEE 754 single precision.
+// The types are created once and locked such that they cannot be closed.
+inline hid_t float16TypeHelper(const std::size_t exponentSize, 
+    const std::size_t mantissaSize, const std::size_t exponentBias) {
+    hid_t type = H5Tcopy(H5T_IEEE_F32LE);
+    if(type < 0
+    || H5Tset_fields(type, 15, mantissaSize, exponentSize, 0, mantissaSize) < 0
+    || H5Tset_size(type, 2) < 0
+    || H5Tset_ebias(type, exponentBias) < 0
+    || H5Tlock(type) < 0) {
+        throw std::runtime_error("could not create 16-bit floating point HDF5 type.");
+    }
+    return type;
+}
+template<> inline hid_t hdf5Type<Float16>() {
+    static const hid_t type = float16TypeHelper(5, 10, 15);
+    return type;
+}
+template<> inline hid_t hdf5Type<BFloat16>() {
+    static const hid_t type = float16TypeHelper(8, 7, 127);
+    return type;
+}
+
 template<class T>
     void save(const hid_t&, const std::string&, const Marray<T>&);
 template<class T, bool isConst>
@@ -214,6 +237,10 @@ void load(
     hid_t filespace = H5Dget_space(dataset);
     hid_t type = H5Dget_type(dataset);
     hid_t nativeType = H5Tget_native_type(type, H5T_DIR_DESCEND);
+    if(H5Tequal(type, hdf5Type<T>()) > 0) { // e.g. Float16 without a native type
+        H5Tclose(nativeType);
+        nativeType = H5Tcopy(type);
+    }
     if(!H5Tequal(nativeType, hdf5Type<T>())) {
         H5Dclose(dataset);
         H5Tclose(nativeType);
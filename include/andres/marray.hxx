@@ -16,12 +16,37 @@
 #include <cstring> // memcpy
 #include <iterator> 
 #include <vector>
+#include <array>
 #include <set>
 #include <iostream> 
 #include <memory> // allocator
+#include <utility> // std::move
 #include <numeric> // accumulate
 #include <functional> // std::multiplies
 #include <initializer_list>
+#include <algorithm> // std::min, std::swap
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <exception> // std::exception_ptr
+#include <tuple>
+#include <type_traits> // std::integral_constant
+#include <cstdint> // std::uintptr_t
+#include <cmath> // std::sqrt, std::exp, std::log
+#include <cstdlib> // std::abs
+#if defined(__GNUC__) && !defined(MARRAY_NO_SIMD) \
+    && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#   include <emmintrin.h> // non-temporal stores
+#endif
+#if defined(__GNUC__) && !defined(MARRAY_NO_SIMD) \
+    && (defined(__x86_64__) || defined(__i386__))
+#   include <immintrin.h> // conversion of Float16
+#endif
+#if defined(__linux__) && !defined(MARRAY_NO_HUGE_PAGES)
+#   include <sys/mman.h> // madvise
+#   include <unistd.h> // sysconf
+#endif
 
 /// The public API.
 namespace andres {
@@ -35,6 +60,18 @@ static const bool Mutable = false; ///< Flag to be used with the template parame
 static const CoordinateOrder defaultOrder = LastMajorOrder; ///< Default order of coordinate tuples.
 static const InitializationSkipping SkipInitialization = InitializationSkipping(); ///< Flag to indicate initialization skipping.
 
+// parallel execution
+inline void setNumberOfThreads(const std::size_t);
+inline std::size_t numberOfThreads();
+inline void setParallelThreshold(const std::size_t);
+inline std::size_t parallelThreshold();
+inline void setStreamingThreshold(const std::size_t);
+inline std::size_t streamingThreshold();
+inline void setScratchCapacity(const std::size_t);
+inline std::size_t scratchCapacity();
+inline void setHugePageThreshold(const std::size_t);
+inline std::size_t hugePageThreshold();
+
 template<class E, class T> 
     class ViewExpression;
 // \cond suppress_doxygen
@@ -46,6 +83,10 @@ template<class E, class T, class S, class BinaryFunctor>
     class BinaryViewExpressionScalarFirst;
 template<class E, class T, class S, class BinaryFunctor> 
     class BinaryViewExpressionScalarSecond;
+template<class T> 
+    class ConstantViewExpression;
+template<class E1, class T1, class E2, class T2, class E3, class T3> 
+    class SelectViewExpression;
 // \endcond suppress_doxygen
 template<class T, bool isConst = false, class A = std::allocator<std::size_t> > 
     class View;
@@ -54,6 +95,78 @@ template<class T, class A>
 template<class T, bool isConst, class A = std::allocator<std::size_t> > 
     class Iterator;
 template<class T, class A = std::allocator<std::size_t> > class Marray;
+template<std::size_t N> class TraversalPlan;
+template<class T, std::size_t N, bool isConst = false> 
+    class FixedRankView;
+template<class T, std::size_t N, class A = std::allocator<std::size_t> > 
+    class FixedRankMarray;
+template<class T, std::size_t... S> 
+    class FixedShapeMarray;
+template<class T, std::size_t ALIGNMENT = 64> 
+    class AlignedAllocator;
+template<class T, std::size_t ALIGNMENT = 64> 
+    class PaddedMarray;
+class Float16;
+class BFloat16;
+
+template<class T, class A>
+    inline void swap(Marray<T, A>&, Marray<T, A>&) noexcept;
+
+// permutation
+template<class T1, bool isConst, class A1, class CoordinateIterator, class T2, class A2>
+    inline void permuteCopy(const View<T1, isConst, A1>&, CoordinateIterator, View<T2, false, A2>&);
+template<class T1, bool isConst, class A1, class T2, class A2>
+    inline void permuteCopy(const View<T1, isConst, A1>&, std::initializer_list<std::size_t>, View<T2, false, A2>&);
+
+// n-ary element-wise operations
+template<class Functor, class T, bool isConst, class A, class... Ts, bool... isConsts, class... As>
+    inline Functor forEach(Functor, const View<T, isConst, A>&, const View<Ts, isConsts, As>&...);
+template<class T, class A, class Functor, class... Ts, bool... isConsts, class... As>
+    inline void transform(View<T, false, A>&, Functor, const View<Ts, isConsts, As>&...);
+
+// reductions
+// \cond suppress_doxygen
+namespace marray_detail {
+    template<class A, class B> struct PromoteType;
+}
+// \endcond suppress_doxygen
+template<class E, class T>
+    inline T sum(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline T min(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline T max(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline T mean(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline T squaredNorm(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline T norm(const ViewExpression<E, T>&);
+template<class E1, class T1, class E2, class T2>
+    inline typename marray_detail::PromoteType<T1, T2>::type 
+        dot(const ViewExpression<E1, T1>&, const ViewExpression<E2, T2>&);
+template<class E, class T>
+    inline std::size_t count(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline bool any(const ViewExpression<E, T>&);
+template<class E, class T>
+    inline bool all(const ViewExpression<E, T>&);
+
+// reductions along one dimension
+template<class T, bool isConst, class A, class BinaryFunctor>
+    inline Marray<T, A> reduce(const View<T, isConst, A>&, const std::size_t, BinaryFunctor);
+template<class T, bool isConst, class A>
+    inline Marray<T, A> sum(const View<T, isConst, A>&, const std::size_t);
+template<class T, bool isConst, class A>
+    inline Marray<T, A> min(const View<T, isConst, A>&, const std::size_t);
+template<class T, bool isConst, class A>
+    inline Marray<T, A> max(const View<T, isConst, A>&, const std::size_t);
+template<class T, bool isConst, class A>
+    inline Marray<T, A> mean(const View<T, isConst, A>&, const std::size_t);
+template<class T, bool isConst, class A>
+    inline Marray<std::size_t, A> argmin(const View<T, isConst, A>&, const std::size_t);
+template<class T, bool isConst, class A>
+    inline Marray<std::size_t, A> argmax(const View<T, isConst, A>&, const std::size_t);
 
 // assertion testing
 #ifdef NDEBUG
@@ -64,6 +177,28 @@ template<class T, class A = std::allocator<std::size_t> > class Marray;
     const bool MARRAY_NO_ARG_TEST = false; ///< Argument testing enabled.
 #endif
 
+// explicit vectorization (can be disabled by defining MARRAY_NO_SIMD)
+// \cond suppress_doxygen
+#if defined(__GNUC__) && !defined(MARRAY_NO_SIMD)
+#   define MARRAY_SIMD
+#   if defined(__x86_64__) || defined(__i386__)
+#       define MARRAY_SIMD_X86
+#   endif
+#endif
+#if defined(MARRAY_SIMD_X86) && defined(__SSE2__)
+#   define MARRAY_STREAMING
+#endif
+#if defined(__linux__) && !defined(MARRAY_NO_HUGE_PAGES)
+#   define MARRAY_HUGE_PAGES
+#endif
+// \endcond suppress_doxygen
+
+// maximal dimension of Views whose shape and strides are stored without
+// dynamic memory allocation (can be changed by defining MARRAY_INLINE_DIMENSION)
+#ifndef MARRAY_INLINE_DIMENSION
+#   define MARRAY_INLINE_DIMENSION 8
+#endif
+
 // \cond suppress_doxygen
 namespace marray_detail {
     // meta-programming
@@ -83,6 +218,13 @@ namespace marray_detail {
         struct IsEqual<T, T>
         { static const bool type = true; };
 
+    template <class E>
+        struct IsConstantExpression
+        { static const bool type = false; };
+    template <class T>
+        struct IsConstantExpression<ConstantViewExpression<T> >
+        { static const bool type = true; };
+
     template<class T> struct TypeTraits
         { static const unsigned char position = 255; };
     template<> struct TypeTraits<char> 
@@ -107,8 +249,16 @@ namespace marray_detail {
         { static const unsigned char position = 9; };
     template<> struct TypeTraits<long double> 
         { static const unsigned char position = 10; };
+    // type in which arithmetic is done: float for 16-bit storage types
+    template<class T> struct ComputeType
+        { typedef T type; };
+    template<> struct ComputeType<Float16>
+        { typedef float type; };
+    template<> struct ComputeType<BFloat16>
+        { typedef float type; };
     template<class A, class B> struct PromoteType
-        { typedef typename IfBool<TypeTraits<A>::position >= TypeTraits<B>::position, A, B>::type type; };
+        { typedef typename ComputeType<A>::type CA; typedef typename ComputeType<B>::type CB;
+          typedef typename IfBool<TypeTraits<CA>::position >= TypeTraits<CB>::position, CA, CB>::type type; };
 
     // assertion testing
     template<class A> inline void Assert(A assertion) {
@@ -117,30 +267,156 @@ namespace marray_detail {
 
     // geometry of views
     template<class A = std::allocator<std::size_t> > class Geometry;
+    template<class V, class D>
+        struct IsDerivedView // true for a class D derived from the View V
+        : std::integral_constant<bool, std::is_base_of<V, D>::value 
+            && !std::is_same<V, D>::value> {};
+    template<std::size_t... S>
+        struct ShapeSize; // number of entries of an array of shape S...
+    template<>
+        struct ShapeSize<> { static const std::size_t value = 1; };
+    template<std::size_t S0, std::size_t... S>
+        struct ShapeSize<S0, S...> { static const std::size_t value = S0 * ShapeSize<S...>::value; };
+
+    // Sequence of n entries that are stored without dynamic memory allocation
+    // if n <= N, e.g. the coordinates of an Iterator.
+    template<class T, std::size_t N>
+    class SmallVector
+    {
+    public:
+        SmallVector(const std::size_t = 0);
+        template<class Iterator>
+            SmallVector(Iterator, Iterator);
+        SmallVector(const SmallVector<T, N>&);
+        SmallVector(SmallVector<T, N>&&) noexcept;
+        ~SmallVector();
+
+        SmallVector<T, N>& operator=(const SmallVector<T, N>&);
+        SmallVector<T, N>& operator=(SmallVector<T, N>&&) noexcept;
+
+        const std::size_t size() const;
+        const T& operator[](const std::size_t) const;
+        T& operator[](const std::size_t);
+        const T* begin() const;
+        T* begin();
+        const T* end() const;
+        T* end();
+
+    private:
+        T* data_;
+        std::size_t size_;
+        T buffer_[N];
+    };
+
     template<class ShapeIterator, class StridesIterator>
         inline void stridesFromShape(ShapeIterator, ShapeIterator,
             StridesIterator, const CoordinateOrder& = defaultOrder);
+    inline std::size_t fixedRankOffset(const std::size_t*);
+    template<class... Args>
+        inline std::size_t fixedRankOffset(const std::size_t*, const std::size_t, const Args...);
 
     // operations on entries of views
     template<class Functor, class T, class A>
         inline void operate(View<T, false, A>&, Functor);
     template<class Functor, class T, class A>
         inline void operate(View<T, false, A>&, const T&, Functor);
-    template<class Functor, class T1, class T2, bool isConst, class A>
-        inline void operate(View<T1, false, A>&, const View<T2, isConst, A>&, Functor);
+    template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+        inline void operate(View<T1, false, A1>&, const View<T2, isConst, A2>&, Functor);
     template<class Functor, class T1, class A, class E, class T2>
         inline void operate(View<T1, false, A>& v, const ViewExpression<E, T2>& expression, Functor f);
+    template<class Functor, class T1, class T2, class A>
+        inline void operateScalar(View<T1, false, A>&, const T2&, Functor);
+    template<class Functor, class T, class A>
+        inline void operateSerial(View<T, false, A>&, Functor);
+    template<class Functor, class T1, class T2, class A>
+        inline void operateSerial(View<T1, false, A>&, const T2&, Functor);
+    template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+        inline void operateSerial(View<T1, false, A1>&, const View<T2, isConst, A2>&, Functor);
+    template<class Functor, class T1, class A, class E, class T2>
+        inline void operateSerial(View<T1, false, A>&, const ViewExpression<E, T2>&, Functor,
+            const std::size_t, const std::size_t);
+
+    template<class Functor, class T>
+        inline void operateStrided(const std::size_t, const std::size_t*, const std::size_t*,
+            T*, Functor);
+    template<class Functor, class T1, class T2>
+        inline void operateStrided(const std::size_t, const std::size_t*, const std::size_t*,
+            T1*, const T2&, Functor);
+    template<class Functor, class T1, class T2>
+        inline void operateStrided(const std::size_t, const std::size_t*, const std::size_t*,
+            const std::size_t*, T1*, const T2*, Functor);
+    template<std::size_t...>
+        struct IndexSequence;
+    template<std::size_t N, std::size_t... I>
+        struct MakeIndexSequence;
+    template<class Functor, class... P, std::size_t... I>
+        inline void traverse(const std::size_t, const std::size_t*, const std::size_t* const*,
+            std::tuple<P...>, Functor&, IndexSequence<I...>);
+    template<class Functor, class T1, class T2>
+        inline void operateBlocked(const std::size_t, const std::size_t, const std::size_t*,
+            const std::size_t*, const std::size_t*, T1*, const T2*, Functor);
+    template<std::size_t N>
+        inline void orderDimensions(const std::size_t, std::size_t*, std::size_t* (&)[N]);
+    template<std::size_t N>
+        inline std::size_t coalesceDimensions(const std::size_t, std::size_t*, std::size_t* (&)[N]);
+    inline bool intersect(const std::size_t, const std::size_t*, const std::size_t*, const std::size_t,
+        const std::size_t, const std::size_t*, const std::size_t*, const std::size_t, const std::ptrdiff_t);
+    template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+        inline bool operateInPlace(View<T1, false, A1>&, const View<T2, isConst, A2>&, Functor);
+    template<class Functor, class T>
+        inline void operateContiguous(T*, const std::size_t, Functor);
+    template<class Functor, class T1, class T2>
+        inline void operateContiguous(T1*, const std::size_t, const T2&, Functor);
+    template<class Functor, class T1, class T2>
+        inline void operateContiguous(T1*, const T2*, const std::size_t, Functor);
+    template<class T1, class T2>
+        struct Assign;
+    inline void operateContiguous(float*, const Float16*, const std::size_t, Assign<float, Float16>);
+    inline void operateContiguous(Float16*, const float*, const std::size_t, Assign<Float16, float>);
+    inline void operateContiguous(float*, const BFloat16*, const std::size_t, Assign<float, BFloat16>);
+    inline void operateContiguous(BFloat16*, const float*, const std::size_t, Assign<BFloat16, float>);
+    inline std::uint16_t floatToHalf(const float);
+    inline float halfToFloat(const std::uint16_t);
+    inline std::uint16_t floatToBFloat16(const float);
+    inline float bfloat16ToFloat(const std::uint16_t);
+
+    template<class E, class T, class R, class Reduction>
+        inline R reduceAll(const ViewExpression<E, T>&, const R&, Reduction);
+    template<class E, class T, class R, class Reduction>
+        inline R reduceAllSerial(const ViewExpression<E, T>&, const R&, Reduction,
+            const std::size_t, const std::size_t);
+    template<class E, class T, class Predicate>
+        inline bool anyOf(const ViewExpression<E, T>&, Predicate);
+    template<class E, class T, class Predicate>
+        inline void anyOfSerial(const ViewExpression<E, T>&, Predicate,
+            const std::size_t, const std::size_t, std::atomic<bool>&);
+
+    template<class T>
+        inline void fillContiguous(T*, const std::size_t, const T&);
+    inline void copyContiguous(void*, const void*, const std::size_t, const std::size_t);
+    template<class T>
+        inline void touchContiguous(T*, const std::size_t);
+    inline void adviseHugePages(void*, const std::size_t);
+    template<class A>
+        inline typename A::pointer allocateContiguous(A&, const std::size_t, const bool);
+
+    // parallel execution
+    class ThreadPool;
+    class ViewPartition;
+    inline std::size_t numberOfChunks(const std::size_t);
+    template<class Task>
+        inline void parallelFor(const std::size_t, Task);
+
+    // scratch memory
+    class ScratchArena;
+    template<class T>
+        class ScratchAllocator;
 
     // helper classes 
-    template<unsigned short N, class Functor, class T, class A>
-        struct OperateHelperUnary;
-    template<unsigned short N, class Functor, class T1, class T2, class A>
-        struct OperateHelperBinaryScalar;
-    template<unsigned short N, class Functor, class T1, class T2, 
-             bool isConst, class A1, class A2>
-        struct OperateHelperBinary;
     template<bool isConstTo, class TFrom, class TTo, class AFrom, class ATo> 
         struct AssignmentOperatorHelper;
+    template<class Iterator>
+        class BroadcastCoordinateIterator;
     template<bool isIntegral> 
         struct AccessOperatorHelper;
 
@@ -171,6 +447,22 @@ namespace marray_detail {
     // unary functors
     template<class T>
         struct Negate { T operator()(const T& x) const { return -x; } };
+    template<class T> inline T absoluteValue(const T& x) { return x < T() ? static_cast<T>(-x) : x; }
+    inline float absoluteValue(const float x) { return std::abs(x); }
+    inline double absoluteValue(const double x) { return std::abs(x); }
+    inline long double absoluteValue(const long double x) { return std::abs(x); }
+    template<class T>
+        struct Abs { T operator()(const T& x) const { return absoluteValue(x); } };
+    template<class T>
+        struct Exp { T operator()(const T& x) const { return static_cast<T>(std::exp(x)); } };
+    template<class T>
+        struct Log { T operator()(const T& x) const { return static_cast<T>(std::log(x)); } };
+    template<class T>
+        struct Sqrt { T operator()(const T& x) const { return static_cast<T>(std::sqrt(x)); } };
+    template<class T>
+        struct Floor { T operator()(const T& x) const { return static_cast<T>(std::floor(x)); } };
+    template<class T>
+        struct Ceil { T operator()(const T& x) const { return static_cast<T>(std::ceil(x)); } };
 
     // binary functors
     template<class T1, class T2, class U>
@@ -181,9 +473,151 @@ namespace marray_detail {
         struct Times { U operator()(const T1& x, const T2& y) const { return x * y; } };
     template<class T1, class T2, class U>
         struct DividedBy { U operator()(const T1& x, const T2& y) const { return x / y; } };
+    template<class T1, class T2, class U>
+        struct Pow { U operator()(const T1& x, const T2& y) const { return static_cast<U>(std::pow(x, y)); } };
+    template<class T1, class T2, class U>
+        struct Minimum { U operator()(const T1& x, const T2& y) const { return y < x ? static_cast<U>(y) : static_cast<U>(x); } };
+    template<class T1, class T2, class U>
+        struct Maximum { U operator()(const T1& x, const T2& y) const { return x < y ? static_cast<U>(y) : static_cast<U>(x); } };
+
+    // comparison functors (U is the type in which x and y are compared)
+    template<class T1, class T2, class U>
+        struct Less { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) < static_cast<U>(y); } };
+    template<class T1, class T2, class U>
+        struct LessEqual { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) <= static_cast<U>(y); } };
+    template<class T1, class T2, class U>
+        struct Greater { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) > static_cast<U>(y); } };
+    template<class T1, class T2, class U>
+        struct GreaterEqual { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) >= static_cast<U>(y); } };
+    template<class T1, class T2, class U>
+        struct EqualTo { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) == static_cast<U>(y); } };
+    template<class T1, class T2, class U>
+        struct NotEqualTo { bool operator()(const T1& x, const T2& y) const { return static_cast<U>(x) != static_cast<U>(y); } };
+
+    // type of the entries of an expression with a binary functor: the 
+    // promoted type U of the operands, except for comparisons
+    template<class BinaryFunctor, class U>
+        struct BinaryResultType { typedef U type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<Less<T1, T2, U>, U> { typedef bool type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<LessEqual<T1, T2, U>, U> { typedef bool type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<Greater<T1, T2, U>, U> { typedef bool type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<GreaterEqual<T1, T2, U>, U> { typedef bool type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<EqualTo<T1, T2, U>, U> { typedef bool type; };
+    template<class T1, class T2, class U>
+        struct BinaryResultType<NotEqualTo<T1, T2, U>, U> { typedef bool type; };
+
+    // predicates
+    template<class T>
+        struct IsNonzero { bool operator()(const T& x) const { return x != T(); } };
+    template<class T>
+        struct IsZero { bool operator()(const T& x) const { return x == T(); } };
+
+    // reductions
+    template<class T>
+        struct SumReduction { 
+            void operator()(T& r, const T& x) const { r += x; } 
+            void combine(T& r, const T& s) const { r += s; } };
+    template<class T>
+        struct SquaredNormReduction { 
+            void operator()(T& r, const T& x) const { r += x * x; } 
+            void combine(T& r, const T& s) const { r += s; } };
+    template<class T>
+        struct MinimumReduction { 
+            void operator()(T& r, const T& x) const { r = x < r ? x : r; } 
+            void combine(T& r, const T& s) const { r = s < r ? s : r; } };
+    template<class T>
+        struct MaximumReduction { 
+            void operator()(T& r, const T& x) const { r = r < x ? x : r; } 
+            void combine(T& r, const T& s) const { r = r < s ? s : r; } };
+    template<class T>
+        struct CountReduction { 
+            void operator()(std::size_t& r, const T& x) const { r += static_cast<std::size_t>(x != T()); } 
+            void combine(std::size_t& r, const std::size_t& s) const { r += s; } };
+    template<class T, class BinaryFunctor>
+        struct Accumulate { 
+            Accumulate(const BinaryFunctor& f) : f_(f) {}
+            void operator()(T& r, const T& x) { r = f_(r, x); } 
+            BinaryFunctor f_; };
+    template<class T, class Functor>
+        struct AxisFold;
+    template<class T, class Compare>
+        struct AxisArgFold;
+    template<class T, class Compare>
+        struct ArgUpdate;
+    template<class Functor, class R, class AR, class T, bool isConst, class A>
+        inline void foldAxis(Marray<R, AR>&, const View<T, isConst, A>&, 
+            const std::size_t, Functor);
+
+    // vectorized evaluation of expressions
+    template<class Functor>
+        struct SimdExpressionFunctor;
+    template<class M, class V>
+        inline void simdWhere(const M&, const V&, V&); // defined if MARRAY_SIMD
 }
 // \endcond suppress_doxygen
    
+/// 16-bit floating point number in IEEE 754 half precision (binary16).
+///
+/// Float16 is a storage type: Values are converted to float for all 
+/// arithmetic and rounded to the nearest Float16 when stored. In 
+/// expressions, Float16 is promoted to float. sum(), squaredNorm() and 
+/// norm() accumulate in float. Assignments between Views of Float16 and 
+/// float use the F16C instructions where available.
+///
+class Float16 {
+public:
+    Float16();
+    Float16(const float);
+    operator float() const;
+
+    static Float16 fromBits(const std::uint16_t);
+    std::uint16_t bits() const;
+
+    Float16& operator+=(const float);
+    Float16& operator-=(const float);
+    Float16& operator*=(const float);
+    Float16& operator/=(const float);
+    Float16& operator++();
+    Float16& operator--();
+    Float16 operator++(int);
+    Float16 operator--(int);
+
+private:
+    std::uint16_t bits_;
+};
+
+/// 16-bit floating point number in the bfloat16 format.
+///
+/// BFloat16 has the 8-bit exponent of float and a 7-bit mantissa. It is
+/// a storage type like Float16.
+///
+class BFloat16 {
+public:
+    BFloat16();
+    BFloat16(const float);
+    operator float() const;
+
+    static BFloat16 fromBits(const std::uint16_t);
+    std::uint16_t bits() const;
+
+    BFloat16& operator+=(const float);
+    BFloat16& operator-=(const float);
+    BFloat16& operator*=(const float);
+    BFloat16& operator/=(const float);
+    BFloat16& operator++();
+    BFloat16& operator--();
+    BFloat16 operator++(int);
+    BFloat16 operator--(int);
+
+private:
+    std::uint16_t bits_;
+};
+
 /// Array-Interface to an interval of memory.
 ///
 /// A view makes a subset of memory look as if it was stored in an 
@@ -222,7 +656,13 @@ public:
     // construction
     View(const allocator_type& = allocator_type());
     View(pointer, const allocator_type& = allocator_type()); 
-    View(const View<T, false, A>&);
+    View(const View<T, isConst, A>&);
+    template<bool isConstLocal, class = typename std::enable_if<isConst && !isConstLocal>::type>
+        View(const View<T, isConstLocal, A>&);
+    View(View<T, isConst, A>&&) noexcept;
+    template<class D, class = typename std::enable_if<
+        marray_detail::IsDerivedView<View<T, isConst, A>, D>::value>::type>
+        View(D&&);
     template<class ShapeIterator>
         View(ShapeIterator, ShapeIterator, pointer,
             const CoordinateOrder& = defaultOrder,
@@ -244,6 +684,10 @@ public:
     View<T, isConst, A>& operator=(const T&);
     View<T, isConst, A>& operator=(const View<T, true, A>&); // over-write default
     View<T, isConst, A>& operator=(const View<T, false, A>&); // over-write default
+    View<T, isConst, A>& operator=(View<T, isConst, A>&&) noexcept(isConst);
+    template<class D>
+        typename std::enable_if<marray_detail::IsDerivedView<View<T, isConst, A>, D>::value,
+            View<T, isConst, A>&>::type operator=(D&&);
     template<class TLocal, bool isConstLocal, class ALocal>
         View<T, isConst, A>& operator=(const View<TLocal, isConstLocal, ALocal>&); 
     template<class E, class Te>
@@ -282,6 +726,8 @@ public:
     const bool isSimple() const; 
     template<class TLocal, bool isConstLocal, class ALocal> 
         bool overlaps(const View<TLocal, isConstLocal, ALocal>&) const;
+    template<class TLocal, bool isConstLocal, class ALocal> 
+        bool overlapsOtherEntries(const View<TLocal, isConstLocal, ALocal>&) const;
 
     // element access
     template<class U> reference operator()(U); 
@@ -364,6 +810,9 @@ public:
     View<T, isConst, A> shiftedView(const int) const;
     View<T, isConst, A> boundView(const std::size_t, const std::size_t = 0) const;
     View<T, isConst, A> squeezedView() const;
+    template<class ShapeIterator>
+        View<T, isConst, A> broadcastedView(ShapeIterator, ShapeIterator) const;
+    View<T, isConst, A> broadcastedView(std::initializer_list<std::size_t>) const;
 
     void reshape(std::initializer_list<std::size_t>);
     void permute(std::initializer_list<std::size_t>);
@@ -387,6 +836,13 @@ public:
     // output as string
     std::string asString(const StringStyle& = MatrixStyle) const; 
 
+    // \cond suppress_doxygen
+    // entries offset, offset+1, ... in memory as a vector x, cf. ViewExpression
+    static const bool vectorizable = marray_detail::TypeTraits<T>::position < 10;
+    template<class V>
+        void vectorAt(const std::size_t, V&) const;
+    // \endcond suppress_doxygen
+
 private:
     typedef typename marray_detail::Geometry<A> geometry_type;
 
@@ -407,6 +863,10 @@ template<class TLocal, bool isConstLocal, class ALocal>
     friend class View;
 template<class TLocal, class ALocal>
     friend class Marray;
+template<class TLocal, std::size_t N, bool isConstLocal>
+    friend class FixedRankView;
+template<class TLocal, std::size_t ALIGNMENT>
+    friend class PaddedMarray;
 // \cond suppress_doxygen
 template<bool isConstTo, class TFrom, class TTo, class AFrom, class ATo> 
     friend struct marray_detail::AssignmentOperatorHelper;
@@ -423,9 +883,20 @@ template<class E, class U, class S, class BinaryFunctor>
     friend class BinaryViewExpressionScalarFirst;
 template<class E, class U, class S, class BinaryFunctor> 
     friend class BinaryViewExpressionScalarSecond;
+template<class E1, class T1, class E2, class T2, class E3, class T3> 
+    friend class SelectViewExpression;
 
 template<class Functor, class T1, class Alocal, class E, class T2>
     friend void marray_detail::operate(View<T1, false, Alocal>& v, const ViewExpression<E, T2>& expression, Functor f);
+template<class Functor, class T1, class Alocal, class E, class T2>
+    friend void marray_detail::operateSerial(View<T1, false, Alocal>&, const ViewExpression<E, T2>&, Functor,
+        const std::size_t, const std::size_t);
+template<class E, class U, class R, class Reduction>
+    friend R marray_detail::reduceAllSerial(const ViewExpression<E, U>&, const R&, Reduction,
+        const std::size_t, const std::size_t);
+template<class E, class U, class Predicate>
+    friend void marray_detail::anyOfSerial(const ViewExpression<E, U>&, Predicate,
+        const std::size_t, const std::size_t, std::atomic<bool>&);
 // \endcond end suppress_doxygen
 };
 
@@ -500,7 +971,7 @@ private:
     view_pointer view_; 
     pointer pointer_;
     std::size_t index_;
-    std::vector<std::size_t> coordinates_;
+    marray_detail::SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinates_;
 
 friend class Marray<T, A>;
 friend class Iterator<T, !isConst, A>; // for comparison operators
@@ -540,6 +1011,7 @@ public:
         const CoordinateOrder& = defaultOrder,
         const allocator_type& = allocator_type());
     Marray(const Marray<T, A>&);
+    Marray(Marray<T, A>&&) noexcept;
     template<class E, class Te>
         Marray(const ViewExpression<E, Te>&,
             const allocator_type& = allocator_type());
@@ -550,11 +1022,13 @@ public:
     // assignment
     Marray<T, A>& operator=(const T&);
     Marray<T, A>& operator=(const Marray<T, A>&); // over-write default
+    Marray<T, A>& operator=(Marray<T, A>&&) noexcept;
     template<class TLocal, bool isConstLocal, class ALocal>
         Marray<T, A>& operator=(const View<TLocal, isConstLocal, ALocal>&);
     template<class E, class Te>
         Marray<T, A>& operator=(const ViewExpression<E, Te>&);
     void assign(const allocator_type& = allocator_type());
+    void swap(Marray<T, A>&) noexcept;
 
     // resize
     template<class ShapeIterator>
@@ -574,99 +1048,415 @@ private:
     allocator_type dataAllocator_;
 };
 
-// implementation of View
-
-/// Compute the index that corresponds to a sequence of coordinates.
+/// Plan for the joint traversal of N Views of equal shape.
 ///
-/// \param coordinate Coordinate given as initializer list.
-/// \param out Index (output)
-/// \sa coordinatesToOffset(), indexToCoordinates(), and indexToOffset()
+/// A TraversalPlan stores the loop nest in which the entries of N Views
+/// are traversed: The dimensions are ordered by the strides of the first
+/// View, and dimensions that can be traversed as one by all Views are 
+/// merged. Once constructed, a plan can be executed repeatedly, with 
+/// different functors and for different data with the same geometry 
+/// (e.g. the same crop of every frame of a video), without deriving the
+/// loop nest again.
 ///
-template<class T, bool isConst, class A>
-inline void
-View<T, isConst, A>::coordinatesToIndex
-(
-    std::initializer_list<std::size_t> coordinate,
-    std::size_t& out
-) const 
+/// \sa forEach()
+///
+template<std::size_t N>
+class TraversalPlan
 {
-    coordinatesToIndex(coordinate.begin(), out);
-}
+public:
+    TraversalPlan();
+    template<class... T, bool... isConst, class... A>
+        TraversalPlan(const View<T, isConst, A>&...);
 
-/// Compute the index that corresponds to a sequence of coordinates.
+    // query
+    const std::size_t dimension() const;
+    const std::size_t size() const;
+    const std::size_t shape(const std::size_t) const;
+    const std::size_t strides(const std::size_t, const std::size_t) const;
+    const std::size_t runLength() const;
+    const bool isContiguous() const;
+
+    // execution
+    template<class Functor, class... P>
+        Functor execute(Functor, P*...) const;
+
+private:
+    std::size_t dimension_;
+    std::size_t size_;
+    std::vector<std::size_t> shape_;
+    std::vector<std::size_t> strides_;
+};
+
+/// View of fixed dimension N.
 ///
-/// \param it An iterator to the beginning of the coordinate sequence.
-/// \param out Index (output)
-/// \sa coordinatesToOffset(), indexToCoordinates(), and indexToOffset()
+/// Shape and strides are stored in arrays of size N, and the offset of an 
+/// entry is computed by N unrolled multiply-adds. Element access thus
+/// involves no loops over the dimension and no branches, and the compiler 
+/// can keep the strides in registers and vectorize loops over entries. 
+/// A FixedRankView converts to a View on the same data, e.g. for the use
+/// in expressions, and is constructed from a View of dimension N.
 ///
-template<class T, bool isConst, class A> 
-template<class CoordinateIterator>
-inline void 
-View<T, isConst, A>::coordinatesToIndex
-(
-    CoordinateIterator it,
-    std::size_t& out
-) const
+/// \sa FixedRankMarray
+///
+template<class T, std::size_t N, bool isConst> 
+class FixedRankView
 {
-    testInvariant();
-    out = 0;
-    for(std::size_t j=0; j<this->dimension(); ++j, ++it) {
-        marray_detail::Assert(MARRAY_NO_ARG_TEST || static_cast<std::size_t>(*it) < shape(j));
-        out += static_cast<std::size_t>(*it) * geometry_.shapeStrides(j);
-    }
-}
+    static_assert(N != 0, "FixedRankView requires a dimension N > 0.");
 
-/// Compute the offset that corresponds to a sequence of coordinates.
+public:
+    typedef T value_type;
+    typedef typename marray_detail::IfBool<isConst, const T*, T*>::type pointer;
+    typedef const T* const_pointer;
+    typedef typename marray_detail::IfBool<isConst, const T&, T&>::type reference;
+    typedef const T& const_reference;
+    typedef std::array<std::size_t, N> shape_type;
+
+    // construction
+    FixedRankView();
+    FixedRankView(const shape_type&, pointer, 
+        const CoordinateOrder& = defaultOrder);
+    FixedRankView(const shape_type&, const shape_type&, pointer,
+        const CoordinateOrder& = defaultOrder);
+    FixedRankView(const FixedRankView<T, N, false>&);
+    template<bool isConstLocal, class A>
+        explicit FixedRankView(const View<T, isConstLocal, A>&);
+
+    // query
+    static constexpr std::size_t dimension() { return N; }
+    const std::size_t size() const;
+    const std::size_t shape(const std::size_t) const;
+    const std::size_t* shapeBegin() const;
+    const std::size_t* shapeEnd() const;
+    const std::size_t strides(const std::size_t) const;
+    const std::size_t* stridesBegin() const;
+    const std::size_t* stridesEnd() const;
+    const CoordinateOrder& coordinateOrder() const;
+
+    // element access
+    template<typename... Args>
+        reference operator()(const Args...) const;
+
+    // sub-views
+    FixedRankView<T, N, isConst> view(const shape_type&, const shape_type&) const;
+    FixedRankView<T, N - 1, isConst> boundView(const std::size_t, const std::size_t = 0) const;
+    FixedRankView<T, N, isConst> transposedView(const std::size_t, const std::size_t) const;
+
+    // conversion to View
+    View<T, isConst> asView() const;
+    template<bool isConstLocal, class A>
+        operator View<T, isConstLocal, A>() const;
+
+protected:
+    pointer data_;
+    shape_type shape_;
+    shape_type strides_;
+    std::size_t size_;
+    CoordinateOrder coordinateOrder_;
+
+template<class TLocal, std::size_t NLocal, bool isConstLocal>
+    friend class FixedRankView;
+};
+
+/// Runtime-flexible array of fixed dimension N.
 ///
-/// \param it An iterator to the beginning of the coordinate sequence.
-/// \param out Index (output)
-/// \sa coordinatesToIndex(), indexToCoordinates(), and indexToOffset()
+/// A FixedRankMarray owns its data and is a FixedRankView on this data.
 ///
-template<class T, bool isConst, class A> 
-inline void
-View<T, isConst, A>::coordinatesToOffset
-(
-    std::initializer_list<std::size_t> coordinate,
-    std::size_t& out
-) const
+/// \sa FixedRankView
+///
+template<class T, std::size_t N, class A> 
+class FixedRankMarray
+: public FixedRankView<T, N, false>
 {
-    coordinatesToOffset(coordinate.begin(), out);
-}
+public:
+    typedef FixedRankView<T, N, false> base;
+    typedef typename base::value_type value_type;
+    typedef typename base::pointer pointer;
+    typedef typename base::reference reference;
+    typedef typename base::shape_type shape_type;
+    typedef typename A::template rebind<value_type>::other allocator_type;
 
-/// Compute the offset that corresponds to a sequence of coordinates.
+    // constructors and destructor
+    FixedRankMarray(const allocator_type& = allocator_type());
+    FixedRankMarray(const shape_type&, const T& = T(),
+        const CoordinateOrder& = defaultOrder,
+        const allocator_type& = allocator_type());
+    FixedRankMarray(const InitializationSkipping&, const shape_type&,
+        const CoordinateOrder& = defaultOrder,
+        const allocator_type& = allocator_type());
+    FixedRankMarray(const FixedRankMarray<T, N, A>&);
+    FixedRankMarray(FixedRankMarray<T, N, A>&&) noexcept;
+    template<class TLocal, bool isConstLocal, class ALocal>
+        explicit FixedRankMarray(const View<TLocal, isConstLocal, ALocal>&);
+    template<class E, class Te>
+        explicit FixedRankMarray(const ViewExpression<E, Te>&,
+            const allocator_type& = allocator_type());
+    ~FixedRankMarray();
+
+    // assignment
+    FixedRankMarray<T, N, A>& operator=(const T&);
+    FixedRankMarray<T, N, A>& operator=(const FixedRankMarray<T, N, A>&);
+    FixedRankMarray<T, N, A>& operator=(FixedRankMarray<T, N, A>&&) noexcept;
+    template<class E, class Te>
+        FixedRankMarray<T, N, A>& operator=(const ViewExpression<E, Te>&);
+
+    // resize
+    void resize(const shape_type&, const T& = T());
+    void resize(const InitializationSkipping&, const shape_type&);
+
+private:
+    template<class ShapeIterator>
+        void allocate(ShapeIterator, const CoordinateOrder&);
+    void deallocate();
+
+    allocator_type dataAllocator_;
+};
+
+/// Array of fixed shape S... whose entries are stored in the object.
 ///
-/// \param it An iterator to the beginning of the coordinate sequence.
-/// \param out Index (output)
-/// \sa coordinatesToIndex(), indexToCoordinates(), and indexToOffset()
+/// A FixedShapeMarray is a View on its own entries, e.g. a 3x3 structure
+/// tensor or a 4x4 transformation matrix, and can be used wherever a View
+/// can be used, in particular in expressions. Neither the entries nor the
+/// shape and strides are allocated dynamically, cf. MARRAY_INLINE_DIMENSION.
+/// Copies and moves copy the entries.
 ///
-template<class T, bool isConst, class A> 
-template<class CoordinateIterator>
-inline void
-View<T, isConst, A>::coordinatesToOffset
-(
-    CoordinateIterator it,
-    std::size_t& out
-) const
+/// \sa Marray, FixedRankMarray
+///
+template<class T, std::size_t... S> 
+class FixedShapeMarray
+: public View<T, false>
 {
-    testInvariant();
-    out = 0;
-    for(std::size_t j=0; j<this->dimension(); ++j, ++it) {
-        marray_detail::Assert(MARRAY_NO_ARG_TEST || static_cast<std::size_t>(*it) < shape(j));
-        out += static_cast<std::size_t>(*it) * strides(j);
-    }
-}
+    static_assert(sizeof...(S) != 0, "FixedShapeMarray requires a shape.");
 
-/// Compute the coordinate sequence that corresponds to an index.
-///
-/// \param index Index
-/// \param outit An iterator into a container into which the coordinate
-/// sequence is to be written (output).
-/// \sa coordinatesToIndex(), coordinatesToOffset(), and indexToOffset()
-///
-template<class T, bool isConst, class A>
-template<class CoordinateIterator>
-inline void
-View<T, isConst, A>::indexToCoordinates
+public:
+    typedef View<T, false> base;
+    typedef typename base::value_type value_type;
+    typedef typename base::pointer pointer;
+    typedef typename base::const_pointer const_pointer;
+    typedef typename base::reference reference;
+    typedef typename base::const_reference const_reference;
+    typedef typename base::iterator iterator;
+    typedef typename base::reverse_iterator reverse_iterator;
+    typedef typename base::const_iterator const_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+
+    // constructors
+    FixedShapeMarray(const T& = T(), const CoordinateOrder& = defaultOrder);
+    FixedShapeMarray(const InitializationSkipping&, 
+        const CoordinateOrder& = defaultOrder);
+    FixedShapeMarray(const FixedShapeMarray<T, S...>&);
+    template<class TLocal, bool isConstLocal, class ALocal>
+        FixedShapeMarray(const View<TLocal, isConstLocal, ALocal>&);
+    template<class E, class Te>
+        FixedShapeMarray(const ViewExpression<E, Te>&);
+
+    // assignment
+    using base::operator=;
+    FixedShapeMarray<T, S...>& operator=(const FixedShapeMarray<T, S...>&);
+
+private:
+    static constexpr std::size_t fixedShape_[sizeof...(S)] = {S...};
+
+    T entries_[marray_detail::ShapeSize<S...>::value];
+};
+
+/// Allocator of memory aligned at multiples of ALIGNMENT bytes.
+///
+/// Used as the allocator of an Marray, e.g. Marray<float, 
+/// AlignedAllocator<std::size_t, 64> >, the data starts at a cache line 
+/// (ALIGNMENT = 64) or a page (ALIGNMENT = 4096) boundary. 
+///
+/// \sa PaddedMarray
+///
+template<class T, std::size_t ALIGNMENT>
+class AlignedAllocator
+{
+    static_assert(ALIGNMENT != 0 && (ALIGNMENT & (ALIGNMENT - 1)) == 0, 
+        "ALIGNMENT must be a power of 2.");
+
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    template<class U> 
+        struct rebind { typedef AlignedAllocator<U, ALIGNMENT> other; };
+    static const std::size_t alignment = ALIGNMENT;
+
+    AlignedAllocator();
+    template<class U>
+        AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&);
+
+    pointer allocate(const size_type, const void* = 0);
+    void deallocate(pointer, const size_type);
+    size_type max_size() const;
+};
+
+/// Runtime-flexible multi-dimensional array whose rows are padded.
+///
+/// The fastest varying dimension (the first for LastMajorOrder, the last
+/// for FirstMajorOrder) is padded in memory to a multiple of ALIGNMENT 
+/// bytes, and the data is aligned at ALIGNMENT bytes. Every row thus starts
+/// at an aligned address, and SIMD loads of rows never cross a cache line 
+/// if ALIGNMENT is the cache line size. The padding is reflected in the 
+/// strides, so a PaddedMarray is a (non-simple) View and can be used 
+/// wherever a View can be used. Padding entries are not part of the View.
+///
+/// \sa Marray, AlignedAllocator
+///
+template<class T, std::size_t ALIGNMENT> 
+class PaddedMarray
+: public View<T, false>
+{
+public:
+    typedef View<T, false> base;
+    typedef typename base::value_type value_type;
+    typedef typename base::pointer pointer;
+    typedef typename base::const_pointer const_pointer;
+    typedef typename base::reference reference;
+    typedef typename base::const_reference const_reference;
+    typedef typename base::iterator iterator;
+    typedef typename base::reverse_iterator reverse_iterator;
+    typedef typename base::const_iterator const_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef AlignedAllocator<T, ALIGNMENT> allocator_type;
+
+    // constructors and destructor
+    PaddedMarray();
+    template<class ShapeIterator>
+        PaddedMarray(ShapeIterator, ShapeIterator, const T& = T(),
+            const CoordinateOrder& = defaultOrder);
+    template<class ShapeIterator>
+        PaddedMarray(const InitializationSkipping&, ShapeIterator, ShapeIterator,
+            const CoordinateOrder& = defaultOrder);
+    PaddedMarray(std::initializer_list<std::size_t>, const T& = T(),
+        const CoordinateOrder& = defaultOrder);
+    PaddedMarray(const PaddedMarray<T, ALIGNMENT>&);
+    PaddedMarray(PaddedMarray<T, ALIGNMENT>&&) noexcept;
+    template<class TLocal, bool isConstLocal, class ALocal>
+        PaddedMarray(const View<TLocal, isConstLocal, ALocal>&);
+    template<class E, class Te>
+        PaddedMarray(const ViewExpression<E, Te>&);
+    ~PaddedMarray();
+
+    // assignment
+    PaddedMarray<T, ALIGNMENT>& operator=(const T&);
+    PaddedMarray<T, ALIGNMENT>& operator=(const PaddedMarray<T, ALIGNMENT>&);
+    PaddedMarray<T, ALIGNMENT>& operator=(PaddedMarray<T, ALIGNMENT>&&) noexcept;
+    template<class TLocal, bool isConstLocal, class ALocal>
+        PaddedMarray<T, ALIGNMENT>& operator=(const View<TLocal, isConstLocal, ALocal>&);
+    template<class E, class Te>
+        PaddedMarray<T, ALIGNMENT>& operator=(const ViewExpression<E, Te>&);
+
+    // query
+    const std::size_t pitch() const;
+
+private:
+    template<class ShapeIterator>
+        void allocate(ShapeIterator, ShapeIterator, const CoordinateOrder&);
+    template<class ShapeIterator>
+        void reallocate(ShapeIterator, ShapeIterator, const CoordinateOrder&);
+    void deallocate();
+
+    std::size_t allocatedSize_;
+    allocator_type dataAllocator_;
+};
+
+// implementation of View
+
+/// Compute the index that corresponds to a sequence of coordinates.
+///
+/// \param coordinate Coordinate given as initializer list.
+/// \param out Index (output)
+/// \sa coordinatesToOffset(), indexToCoordinates(), and indexToOffset()
+///
+template<class T, bool isConst, class A>
+inline void
+View<T, isConst, A>::coordinatesToIndex
+(
+    std::initializer_list<std::size_t> coordinate,
+    std::size_t& out
+) const 
+{
+    coordinatesToIndex(coordinate.begin(), out);
+}
+
+/// Compute the index that corresponds to a sequence of coordinates.
+///
+/// \param it An iterator to the beginning of the coordinate sequence.
+/// \param out Index (output)
+/// \sa coordinatesToOffset(), indexToCoordinates(), and indexToOffset()
+///
+template<class T, bool isConst, class A> 
+template<class CoordinateIterator>
+inline void 
+View<T, isConst, A>::coordinatesToIndex
+(
+    CoordinateIterator it,
+    std::size_t& out
+) const
+{
+    testInvariant();
+    out = 0;
+    for(std::size_t j=0; j<this->dimension(); ++j, ++it) {
+        marray_detail::Assert(MARRAY_NO_ARG_TEST || static_cast<std::size_t>(*it) < shape(j));
+        out += static_cast<std::size_t>(*it) * geometry_.shapeStrides(j);
+    }
+}
+
+/// Compute the offset that corresponds to a sequence of coordinates.
+///
+/// \param it An iterator to the beginning of the coordinate sequence.
+/// \param out Index (output)
+/// \sa coordinatesToIndex(), indexToCoordinates(), and indexToOffset()
+///
+template<class T, bool isConst, class A> 
+inline void
+View<T, isConst, A>::coordinatesToOffset
+(
+    std::initializer_list<std::size_t> coordinate,
+    std::size_t& out
+) const
+{
+    coordinatesToOffset(coordinate.begin(), out);
+}
+
+/// Compute the offset that corresponds to a sequence of coordinates.
+///
+/// \param it An iterator to the beginning of the coordinate sequence.
+/// \param out Index (output)
+/// \sa coordinatesToIndex(), indexToCoordinates(), and indexToOffset()
+///
+template<class T, bool isConst, class A> 
+template<class CoordinateIterator>
+inline void
+View<T, isConst, A>::coordinatesToOffset
+(
+    CoordinateIterator it,
+    std::size_t& out
+) const
+{
+    testInvariant();
+    out = 0;
+    for(std::size_t j=0; j<this->dimension(); ++j, ++it) {
+        marray_detail::Assert(MARRAY_NO_ARG_TEST || static_cast<std::size_t>(*it) < shape(j));
+        out += static_cast<std::size_t>(*it) * strides(j);
+    }
+}
+
+/// Compute the coordinate sequence that corresponds to an index.
+///
+/// \param index Index
+/// \param outit An iterator into a container into which the coordinate
+/// sequence is to be written (output).
+/// \sa coordinatesToIndex(), coordinatesToOffset(), and indexToOffset()
+///
+template<class T, bool isConst, class A>
+template<class CoordinateIterator>
+inline void
+View<T, isConst, A>::indexToCoordinates
 (
     std::size_t index, // copy to work on
     CoordinateIterator outit
@@ -798,15 +1588,35 @@ View<T, isConst, A>::View
     testInvariant();
 }
 
-/// Construct View from a View on mutable data.
+/// Copy constructor.
+///
+/// \param in View (source).
+///
+template<class T, bool isConst, class A> 
+inline
+View<T, isConst, A>::View
+(
+    const View<T, isConst, A>& in
+)
+: data_(in.data_),
+  geometry_(in.geometry_)
+{
+    testInvariant();
+}
+
+/// Construct a View on constant data from a View on mutable data.
+///
+/// This constructor exists only for Views on constant data. A View 
+/// on mutable data cannot be constructed from a View on constant data.
 ///
 /// \param in View on mutable data.
 ///
 template<class T, bool isConst, class A> 
+template<bool isConstLocal, class>
 inline
 View<T, isConst, A>::View
 (
-    const View<T, false, A>& in
+    const View<T, isConstLocal, A>& in
 )
 : data_(in.data_),
   geometry_(in.geometry_)
@@ -814,6 +1624,44 @@ View<T, isConst, A>::View
     testInvariant();
 }
 
+/// Move constructor.
+///
+/// The geometry of 'in' is taken over without copying, and 'in' is left
+/// un-initialized.
+///
+/// \param in View (source).
+///
+template<class T, bool isConst, class A> 
+inline
+View<T, isConst, A>::View
+(
+    View<T, isConst, A>&& in
+) noexcept
+: data_(in.data_),
+  geometry_(std::move(in.geometry_))
+{
+    in.data_ = 0;
+}
+
+/// Construct View from a temporary array that owns its data.
+///
+/// Arrays derived from View such as Marray, FixedShapeMarray and 
+/// PaddedMarray own their data and are not moved from. Like for any
+/// such array, the View only copies the data pointer and the geometry.
+///
+/// \param in Array derived from View.
+///
+template<class T, bool isConst, class A> 
+template<class D, class>
+inline
+View<T, isConst, A>::View
+(
+    D&& in
+)
+: View(static_cast<const View<T, isConst, A>&>(in))
+{
+}
+
 /// Construct unstrided View
 /// 
 /// \param begin Iterator to the beginning of a sequence that
@@ -1428,6 +2276,54 @@ View<T, isConst, A>::operator=
     return *this;
 }
 
+/// Move assignment.
+///
+/// Like the copy assignment, the operator copies the data under 'in' 
+/// to the memory under *this if *this is an initialized View on mutable
+/// data. Otherwise, the geometry of 'in' is taken over without copying,
+/// and 'in' is left un-initialized.
+///
+/// \param in View (source).
+///
+template<class T, bool isConst, class A> 
+inline View<T, isConst, A>&
+View<T, isConst, A>::operator=
+(
+    View<T, isConst, A>&& in
+) noexcept(isConst)
+{
+    if(isConst || data_ == 0) {
+        if(&in != this) {
+            data_ = in.data_;
+            geometry_ = std::move(in.geometry_);
+            in.data_ = 0;
+        }
+    }
+    else {
+        (*this) = static_cast<const View<T, isConst, A>&>(in);
+    }
+    return *this;
+}
+
+/// Assignment from a temporary array that owns its data.
+///
+/// Arrays derived from View such as Marray, FixedShapeMarray and 
+/// PaddedMarray own their data and are not moved from.
+///
+/// \param in Array derived from View.
+///
+template<class T, bool isConst, class A> 
+template<class D>
+inline typename std::enable_if<marray_detail::IsDerivedView<View<T, isConst, A>, D>::value,
+    View<T, isConst, A>&>::type
+View<T, isConst, A>::operator=
+(
+    D&& in
+)
+{
+    return (*this) = static_cast<const View<T, isConst, A>&>(in);
+}
+
 /// Assignment.
 ///
 template<class T, bool isConst, class A> 
@@ -1458,36 +2354,7 @@ View<T, isConst, A>::operator=
 )
 {
     marray_detail::Assert(MARRAY_NO_DEBUG || data_ != 0);
-    if(isSimple()) {
-        for(std::size_t j=0; j<geometry_.size(); ++j) {
-            data_[j] = value;
-        }
-    }
-    else if(dimension() == 1)
-        marray_detail::OperateHelperBinaryScalar<1, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 2)
-        marray_detail::OperateHelperBinaryScalar<2, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 3)
-        marray_detail::OperateHelperBinaryScalar<3, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 4)
-        marray_detail::OperateHelperBinaryScalar<4, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 5)
-        marray_detail::OperateHelperBinaryScalar<5, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 6)
-        marray_detail::OperateHelperBinaryScalar<6, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 7)
-        marray_detail::OperateHelperBinaryScalar<7, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 8)
-        marray_detail::OperateHelperBinaryScalar<8, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 9)
-        marray_detail::OperateHelperBinaryScalar<9, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else if(dimension() == 10)
-        marray_detail::OperateHelperBinaryScalar<10, marray_detail::Assign<T, T>, T, T, A>::operate(*this, value, marray_detail::Assign<T, T>(), data_);
-    else {
-        for(iterator it = begin(); it.hasMore(); ++it) {
-            *it = value;
-        }
-    }
+    marray_detail::operate(*this, value, marray_detail::Assign<T, T>());
     return *this;
 }
 
@@ -1986,36 +2853,103 @@ View<T, isConst, A>::squeezedView() const
     return v;
 }
 
-/// Permute dimensions.
+/// Get a View of a larger shape in which the entries are repeated.
 ///
-/// \param begin Iterator to the beginning of a sequence which
-/// has to contain the integers 0, ..., dimension()-1 in any
-/// order. Otherwise, a runtime error is thrown.
-/// \sa permutedView(), transpose(), transposedView(), shift(),
-/// shiftedView()
+/// The shape of the View is aligned with the given shape at the last 
+/// dimension. Dimensions that are missing in the View and singleton
+/// dimensions of the View are broadcast, i.e. their strides are set to
+/// zero such that every entry is repeated without being copied.
 ///
-template<class T, bool isConst, class A>
-void
-View<T, isConst, A>::permute
-(
-    std::initializer_list<std::size_t> permutation
-)
-{
-    permute(permutation.begin());
-}
-
-/// Permute dimensions.
+/// \param begin Iterator to the beginning of a sequence that defines
+/// the new shape. Each of the last dimension() numbers has to be equal 
+/// to the corresponding extent of the View or the View has to be 
+/// singleton in this dimension. Otherwise, a runtime error is thrown.
+/// \param end Iterator to the end of this sequence.
 ///
-/// \param begin Iterator to the beginning of a sequence which
-/// has to contain the integers 0, ..., dimension()-1 in any
-/// order. Otherwise, a runtime error is thrown.
-/// \sa permutedView(), transpose(), transposedView(), shift(),
-/// shiftedView()
+/// \sa squeezedView()
 ///
 template<class T, bool isConst, class A> 
-template<class CoordinateIterator>
-void
-View<T, isConst, A>::permute
+template<class ShapeIterator>
+View<T, isConst, A>
+View<T, isConst, A>::broadcastedView
+(
+    ShapeIterator begin,
+    ShapeIterator end
+) const
+{
+    testInvariant();
+    const std::size_t dimension = static_cast<std::size_t>(std::distance(begin, end));
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || (data_ != 0 && dimension >= this->dimension()));
+    const std::size_t skip = dimension - this->dimension();
+    View<T, isConst, A> v = *this;
+    v.geometry_.resize(dimension);
+    std::size_t size = 1;
+    for(std::size_t j=0; j<dimension; ++j, ++begin) {
+        const std::size_t extent = static_cast<std::size_t>(*begin);
+        v.geometry_.shape(j) = extent;
+        if(j < skip || shape(j - skip) == 1) {
+            v.geometry_.strides(j) = 0;
+        }
+        else {
+            marray_detail::Assert(MARRAY_NO_ARG_TEST || shape(j - skip) == extent);
+            v.geometry_.strides(j) = strides(j - skip);
+        }
+        size *= extent;
+    }
+    v.geometry_.size() = size;
+    marray_detail::stridesFromShape(v.geometry_.shapeBegin(), v.geometry_.shapeEnd(),
+        v.geometry_.shapeStridesBegin(), v.geometry_.coordinateOrder());
+    v.updateSimplicity();
+    v.testInvariant();
+    return v;
+}
+
+/// Get a View of a larger shape in which the entries are repeated.
+///
+/// \param shape Shape initializer list.
+///
+/// \sa broadcastedView(ShapeIterator, ShapeIterator)
+///
+template<class T, bool isConst, class A> 
+inline View<T, isConst, A>
+View<T, isConst, A>::broadcastedView
+(
+    std::initializer_list<std::size_t> shape
+) const
+{
+    return broadcastedView(shape.begin(), shape.end());
+}
+
+/// Permute dimensions.
+///
+/// \param begin Iterator to the beginning of a sequence which
+/// has to contain the integers 0, ..., dimension()-1 in any
+/// order. Otherwise, a runtime error is thrown.
+/// \sa permutedView(), transpose(), transposedView(), shift(),
+/// shiftedView()
+///
+template<class T, bool isConst, class A>
+void
+View<T, isConst, A>::permute
+(
+    std::initializer_list<std::size_t> permutation
+)
+{
+    permute(permutation.begin());
+}
+
+/// Permute dimensions.
+///
+/// \param begin Iterator to the beginning of a sequence which
+/// has to contain the integers 0, ..., dimension()-1 in any
+/// order. Otherwise, a runtime error is thrown.
+/// \sa permutedView(), transpose(), transposedView(), shift(),
+/// shiftedView()
+///
+template<class T, bool isConst, class A> 
+template<class CoordinateIterator>
+void
+View<T, isConst, A>::permute
 (
     CoordinateIterator begin
 )
@@ -2382,6 +3316,21 @@ View<T, isConst, A>::operator[]
     return data_[offset];
 }
 
+// \cond suppress_doxygen
+template<class T, bool isConst, class A> 
+template<class V>
+inline void
+View<T, isConst, A>::vectorAt
+(
+    const std::size_t offset,
+    V& x
+) 
+const
+{
+    std::memcpy(&x, data_ + offset, sizeof(V));
+}
+// \endcond suppress_doxygen
+
 /// Test invariant.
 ///
 /// This function tests the invariant of View and thus the consistency
@@ -2436,15 +3385,16 @@ View<T, isConst, A>::testInvariant() const
 
 /// Check whether two Views overlap.
 ///
-/// This function returns true if two memory intervals overlap:
-/// (1) the interval between the first and the last element of the object
-/// whose member function overlaps() is called.
-/// (2) the interval between the first and the last element of v.
+/// This function returns true if there exists a byte of memory that is
+/// part of an entry of v as well as part of an entry of the current object.
 ///
-/// Note that this not necessarily implies the existence of an element 
-/// that is addressed by both v and the current object. v could for
-/// instance address all odd elements in a vector while the current
-/// object addresses all even elements. 
+/// Views whose memory intervals overlap need not address a common entry. 
+/// v could for instance address all odd elements in a vector while the 
+/// current object addresses all even elements, or v and the current object
+/// could address different channels of an image. Such Views are recognized
+/// as disjoint by a search over the strides. This search is exact for 
+/// all practical purposes. Only if it exceeds a fixed number of steps, the
+/// Views are considered to overlap.
 ///
 /// \param v A view to compare with *this.
 /// \return bool.
@@ -2464,17 +3414,62 @@ inline bool View<T, isConst, A>::overlaps
         return false;
     }
     else {
-        const void* dataPointer_ = data_;
-        const void* vDataPointer_ = v.data_;
-        const void* maxPointer = & (*this)(this->size()-1);
-        const void* maxPointerV = & v(v.size()-1);
-        if(    (dataPointer_   <= vDataPointer_ && vDataPointer_ <= maxPointer)
-            || (vDataPointer_ <= dataPointer_   && dataPointer_   <= maxPointerV) )
-        {
-            return true;
+        const char* dataPointer_ = reinterpret_cast<const char*>(data_);
+        const char* vDataPointer_ = reinterpret_cast<const char*>(v.data_);
+        const char* endPointer = reinterpret_cast<const char*>(&(*this)(this->size()-1)) + sizeof(T);
+        const char* endPointerV = reinterpret_cast<const char*>(&v(v.size()-1)) + sizeof(TLocal);
+        if(endPointer <= vDataPointer_ || endPointerV <= dataPointer_) {
+            return false; // disjoint memory intervals
         }
+        const std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(
+            reinterpret_cast<std::uintptr_t>(vDataPointer_) 
+            - reinterpret_cast<std::uintptr_t>(dataPointer_));
+        return marray_detail::intersect(
+            geometry_.dimension(), geometry_.shapeBegin(), geometry_.stridesBegin(), sizeof(T),
+            v.geometry_.dimension(), v.geometry_.shapeBegin(), v.geometry_.stridesBegin(), sizeof(TLocal),
+            offset);
     }
-    return false;
+}
+
+/// Check whether two Views overlap other than entry by entry.
+///
+/// This function returns false if v and the current object address the 
+/// same entries at the same coordinates, like the operand a of the 
+/// assignment a = a * 2 + b. Expressions in which such Views occur can be
+/// evaluated in place because every entry is read only to compute the
+/// same entry of the result. In all other cases, the function returns
+/// overlaps(v).
+///
+/// \param v A view to compare with *this.
+/// \return bool.
+///
+/// \sa overlaps()
+///
+template<class T, bool isConst, class A> 
+template<class TLocal, bool isConstLocal, class ALocal>
+inline bool View<T, isConst, A>::overlapsOtherEntries
+(
+    const View<TLocal, isConstLocal, ALocal>& v
+) const
+{
+    if(marray_detail::IsEqual<T, TLocal>::type
+    && data_ != 0 
+    && static_cast<const void*>(data_) == static_cast<const void*>(v.data_)
+    && geometry_.dimension() == v.geometry_.dimension()
+    && std::equal(geometry_.shapeBegin(), geometry_.shapeEnd(), v.geometry_.shapeBegin())) {
+        bool sameEntries = true;
+        for(std::size_t j=0; j<geometry_.dimension(); ++j) {
+            if(geometry_.shape(j) != 1 && (geometry_.strides(j) != v.geometry_.strides(j)
+            || geometry_.strides(j) == 0)) { // broadcast Views address entries repeatedly
+                sameEntries = false;
+                break;
+            }
+        }
+        if(sameEntries) {
+            return false;
+        }
+    }
+    return overlaps(v);
 }
 
 /// Output as string.
@@ -2859,6 +3854,342 @@ MARRAY_BINARY_OPERATOR_ALL_TYPES(-, Minus)
 MARRAY_BINARY_OPERATOR_ALL_TYPES(*, Times)
 MARRAY_BINARY_OPERATOR_ALL_TYPES(/, DividedBy)
 
+// comparisons
+//
+// Comparisons of Views, ViewExpressions and scalars are expressions whose
+// entries are of type bool. The operands are compared in their promoted 
+// type. Such masks are evaluated lazily, like all other expressions, and 
+// can be assigned to a View or Marray of bool, reduced by count(), any() 
+// and all() or used to select entries by where().
+
+#define MARRAY_COMPARISON_OPERATOR(operation, functorname) \
+template<class E1, class T1, class E2, class T2> \
+inline const BinaryViewExpression<E1, T1, E2, T2, \
+    marray_detail:: functorname <T1, T2, typename marray_detail::PromoteType<T1, T2>::type> > \
+operator operation \
+( \
+    const ViewExpression<E1, T1>& expression1, \
+    const ViewExpression<E2, T2>& expression2 \
+) \
+{ \
+    typedef typename marray_detail::PromoteType<T1, T2>::type promoted_type; \
+    typedef marray_detail:: functorname <T1, T2, promoted_type> Functor; \
+    typedef BinaryViewExpression<E1, T1, E2, T2, Functor> return_type; \
+    return return_type(expression1, expression2); \
+} \
+\
+MARRAY_BINARY_OPERATOR_ALL_TYPES(operation, functorname)
+
+MARRAY_COMPARISON_OPERATOR(<, Less)
+MARRAY_COMPARISON_OPERATOR(<=, LessEqual)
+MARRAY_COMPARISON_OPERATOR(>, Greater)
+MARRAY_COMPARISON_OPERATOR(>=, GreaterEqual)
+MARRAY_COMPARISON_OPERATOR(==, EqualTo)
+MARRAY_COMPARISON_OPERATOR(!=, NotEqualTo)
+
+// element-wise mathematical functions
+//
+// Like the arithmetic operators, these functions return expressions that
+// are evaluated entry by entry when assigned. Simple expressions of float 
+// and double are evaluated in SIMD vectors (cf. marray_detail::simdExp()).
+
+/// Exponential function of each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Exp<T> >
+exp
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Exp<T> >(expression);
+}
+
+/// Natural logarithm of each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Log<T> >
+log
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Log<T> >(expression);
+}
+
+/// Square root of each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Sqrt<T> >
+sqrt
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Sqrt<T> >(expression);
+}
+
+/// Absolute value of each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Abs<T> >
+abs
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Abs<T> >(expression);
+}
+
+/// Largest integer not greater than each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Floor<T> >
+floor
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Floor<T> >(expression);
+}
+
+/// Smallest integer not less than each entry of a View or ViewExpression.
+///
+/// \param expression View or ViewExpression.
+///
+template<class E, class T>
+inline const UnaryViewExpression<E, T, marray_detail::Ceil<T> >
+ceil
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    return UnaryViewExpression<E, T, marray_detail::Ceil<T> >(expression);
+}
+
+/// Power of the entries of two Views or ViewExpressions.
+///
+/// \param expression1 Bases.
+/// \param expression2 Exponents.
+///
+template<class E1, class T1, class E2, class T2>
+inline const BinaryViewExpression<E1, T1, E2, T2,
+    marray_detail::Pow<T1, T2, typename marray_detail::PromoteType<T1, T2>::type> >
+pow
+(
+    const ViewExpression<E1, T1>& expression1, 
+    const ViewExpression<E2, T2>& expression2
+)
+{
+    typedef typename marray_detail::PromoteType<T1, T2>::type promoted_type;
+    typedef marray_detail::Pow<T1, T2, promoted_type> Functor;
+    typedef BinaryViewExpression<E1, T1, E2, T2, Functor> return_type; 
+    return return_type(expression1, expression2);
+}
+
+/// Element-wise minimum of two Views or ViewExpressions.
+///
+/// Unlike min(), which reduces all entries to one, minimum() compares
+/// corresponding entries. Shapes are broadcast as for arithmetic operators.
+///
+/// \param expression1 View or ViewExpression.
+/// \param expression2 View or ViewExpression.
+///
+template<class E1, class T1, class E2, class T2>
+inline const BinaryViewExpression<E1, T1, E2, T2,
+    marray_detail::Minimum<T1, T2, typename marray_detail::PromoteType<T1, T2>::type> >
+minimum
+(
+    const ViewExpression<E1, T1>& expression1, 
+    const ViewExpression<E2, T2>& expression2
+)
+{
+    typedef typename marray_detail::PromoteType<T1, T2>::type promoted_type;
+    typedef marray_detail::Minimum<T1, T2, promoted_type> Functor;
+    typedef BinaryViewExpression<E1, T1, E2, T2, Functor> return_type; 
+    return return_type(expression1, expression2);
+}
+
+/// Element-wise maximum of two Views or ViewExpressions.
+///
+/// \param expression1 View or ViewExpression.
+/// \param expression2 View or ViewExpression.
+///
+template<class E1, class T1, class E2, class T2>
+inline const BinaryViewExpression<E1, T1, E2, T2,
+    marray_detail::Maximum<T1, T2, typename marray_detail::PromoteType<T1, T2>::type> >
+maximum
+(
+    const ViewExpression<E1, T1>& expression1, 
+    const ViewExpression<E2, T2>& expression2
+)
+{
+    typedef typename marray_detail::PromoteType<T1, T2>::type promoted_type;
+    typedef marray_detail::Maximum<T1, T2, promoted_type> Functor;
+    typedef BinaryViewExpression<E1, T1, E2, T2, Functor> return_type; 
+    return return_type(expression1, expression2);
+}
+
+#define MARRAY_BINARY_FUNCTION(datatype, name, functorname) \
+template<class E, class T> \
+inline const BinaryViewExpressionScalarSecond< \
+    E, T, datatype, marray_detail:: functorname < \
+        T, datatype, typename marray_detail::PromoteType<T, datatype>::type \
+    > \
+> \
+name \
+( \
+    const ViewExpression<E, T>& expression, \
+    const datatype& scalar \
+) \
+{ \
+    typedef typename marray_detail::PromoteType<T, datatype>::type \
+        promoted_type; \
+    typedef marray_detail:: functorname <T, datatype, promoted_type> Functor; \
+    typedef BinaryViewExpressionScalarSecond<E, T, datatype, Functor> \
+        expression_type; \
+    return expression_type(expression, scalar); \
+} \
+\
+template<class E, class T> \
+inline const BinaryViewExpressionScalarFirst \
+< \
+    E, T, datatype, marray_detail:: functorname < \
+        datatype, T, typename marray_detail::PromoteType<datatype, T>::type \
+    > \
+> \
+name \
+( \
+    const datatype& scalar, \
+    const ViewExpression<E, T>& expression \
+) \
+{ \
+    typedef typename marray_detail::PromoteType<T, datatype>::type \
+        promoted_type; \
+    typedef marray_detail:: functorname <datatype, T, promoted_type> Functor; \
+    typedef BinaryViewExpressionScalarFirst<E, T, datatype, Functor> \
+        expression_type; \
+    return expression_type(expression, scalar); \
+}
+
+#define MARRAY_BINARY_FUNCTION_ALL_TYPES(name, functorname) \
+    MARRAY_BINARY_FUNCTION(char, name, functorname) \
+    MARRAY_BINARY_FUNCTION(unsigned char, name, functorname) \
+    MARRAY_BINARY_FUNCTION(short, name, functorname) \
+    MARRAY_BINARY_FUNCTION(unsigned short, name, functorname) \
+    MARRAY_BINARY_FUNCTION(int, name, functorname) \
+    MARRAY_BINARY_FUNCTION(unsigned int, name, functorname) \
+    MARRAY_BINARY_FUNCTION(long, name, functorname) \
+    MARRAY_BINARY_FUNCTION(unsigned long, name, functorname) \
+    MARRAY_BINARY_FUNCTION(float, name, functorname) \
+    MARRAY_BINARY_FUNCTION(double, name, functorname) \
+    MARRAY_BINARY_FUNCTION(long double, name, functorname) \
+
+MARRAY_BINARY_FUNCTION_ALL_TYPES(pow, Pow)
+MARRAY_BINARY_FUNCTION_ALL_TYPES(minimum, Minimum)
+MARRAY_BINARY_FUNCTION_ALL_TYPES(maximum, Maximum)
+
+/// Select entries of two Views or ViewExpressions by a mask.
+///
+/// The entry of the result is that of the expression a where the mask is 
+/// true and that of b elsewhere. The mask and both operands are broadcast
+/// to a common shape, cf. View::broadcastedView(). The entries can be of
+/// any type. If the mask is a comparison of operands of the same arithmetic
+/// type as the result, e.g. of float, double or int, the selection is 
+/// evaluated without branches in SIMD vectors.
+///
+/// \param mask View or ViewExpression, e.g. a comparison.
+/// \param a View or ViewExpression for the entries where the mask is true.
+/// \param b View or ViewExpression for all other entries.
+///
+/// \sa count(), any(), all()
+///
+template<class E1, class T1, class E2, class T2, class E3, class T3>
+inline const SelectViewExpression<E1, T1, E2, T2, E3, T3>
+where
+(
+    const ViewExpression<E1, T1>& mask, 
+    const ViewExpression<E2, T2>& a, 
+    const ViewExpression<E3, T3>& b
+)
+{
+    return SelectViewExpression<E1, T1, E2, T2, E3, T3>(mask, a, b);
+}
+
+// a scalar operand is converted to the promoted type. Two scalars have
+// to be of the same type.
+#define MARRAY_WHERE(datatype) \
+template<class E1, class T1, class E, class T> \
+inline const SelectViewExpression<E1, T1, E, T, \
+    ConstantViewExpression<typename marray_detail::PromoteType<T, datatype>::type>, \
+    typename marray_detail::PromoteType<T, datatype>::type> \
+where \
+( \
+    const ViewExpression<E1, T1>& mask, \
+    const ViewExpression<E, T>& a, \
+    const datatype& b \
+) \
+{ \
+    typedef typename marray_detail::PromoteType<T, datatype>::type promoted_type; \
+    typedef ConstantViewExpression<promoted_type> constant_type; \
+    typedef SelectViewExpression<E1, T1, E, T, constant_type, promoted_type> return_type; \
+    return return_type(mask, a, constant_type(static_cast<promoted_type>(b))); \
+} \
+\
+template<class E1, class T1, class E, class T> \
+inline const SelectViewExpression<E1, T1, \
+    ConstantViewExpression<typename marray_detail::PromoteType<T, datatype>::type>, \
+    typename marray_detail::PromoteType<T, datatype>::type, E, T> \
+where \
+( \
+    const ViewExpression<E1, T1>& mask, \
+    const datatype& a, \
+    const ViewExpression<E, T>& b \
+) \
+{ \
+    typedef typename marray_detail::PromoteType<T, datatype>::type promoted_type; \
+    typedef ConstantViewExpression<promoted_type> constant_type; \
+    typedef SelectViewExpression<E1, T1, constant_type, promoted_type, E, T> return_type; \
+    return return_type(mask, constant_type(static_cast<promoted_type>(a)), b); \
+} \
+\
+template<class E1, class T1> \
+inline const SelectViewExpression<E1, T1, ConstantViewExpression<datatype>, datatype, \
+    ConstantViewExpression<datatype>, datatype> \
+where \
+( \
+    const ViewExpression<E1, T1>& mask, \
+    const datatype& a, \
+    const datatype& b \
+) \
+{ \
+    typedef ConstantViewExpression<datatype> constant_type; \
+    typedef SelectViewExpression<E1, T1, constant_type, datatype, constant_type, datatype> return_type; \
+    return return_type(mask, constant_type(a), constant_type(b)); \
+}
+
+MARRAY_WHERE(char)
+MARRAY_WHERE(unsigned char)
+MARRAY_WHERE(short)
+MARRAY_WHERE(unsigned short)
+MARRAY_WHERE(int)
+MARRAY_WHERE(unsigned int)
+MARRAY_WHERE(long)
+MARRAY_WHERE(unsigned long)
+MARRAY_WHERE(float)
+MARRAY_WHERE(double)
+MARRAY_WHERE(long double)
+
 // implementation of Marray
 
 /// Clear Marray.
@@ -2944,35 +4275,57 @@ Marray<T, A>::Marray
         this->data_ = 0;
     }
     else {
-        this->data_ = dataAllocator_.allocate(in.size());
-        memcpy(this->data_, in.data_, (in.size())*sizeof(T));
+        this->data_ = marray_detail::allocateContiguous(dataAllocator_, in.size(), true);
+        marray_detail::copyContiguous(this->data_, in.data_, in.size(), sizeof(T));
     }
     this->geometry_ = in.geometry_;
     testInvariant();
 }
 
-/// Copy from a View.
+/// Move constructor.
 ///
-/// \param in View (source).
+/// The data and geometry of 'in' are taken over without copying, and
+/// 'in' is left un-initialized.
+///
+/// \param in Marray (source).
 ///
 template<class T, class A> 
-template<class TLocal, bool isConstLocal, class ALocal>
 inline
 Marray<T, A>::Marray
 (
-    const View<TLocal, isConstLocal, ALocal>& in
-) 
-: dataAllocator_()
+    Marray<T, A>&& in
+) noexcept
+:   base(static_cast<base&&>(in)),
+    dataAllocator_(in.dataAllocator_) 
 {
-    if(!MARRAY_NO_ARG_TEST) {
+}
+
+/// Copy from a View.
+///
+/// \param in View (source).
+///
+template<class T, class A> 
+template<class TLocal, bool isConstLocal, class ALocal>
+inline
+Marray<T, A>::Marray
+(
+    const View<TLocal, isConstLocal, ALocal>& in
+) 
+: dataAllocator_()
+{
+    if(!MARRAY_NO_ARG_TEST) {
         in.testInvariant();
     }
 
-    // adapt geometry
-    this->geometry_ = in.geometry_;
+    // adapt geometry (in can use a different allocator)
+    this->geometry_.resize(in.dimension());
     for(std::size_t j=0; j<in.dimension(); ++j) {
+        this->geometry_.shape(j) = in.geometry_.shape(j);
+        this->geometry_.shapeStrides(j) = in.geometry_.shapeStrides(j);
         this->geometry_.strides(j) = in.geometry_.shapeStrides(j); // !
     }
+    this->geometry_.size() = in.size();
+    this->geometry_.coordinateOrder() = in.coordinateOrder();
     this->geometry_.isSimple() = true;
 
     // copy data
@@ -2980,16 +4333,13 @@ Marray<T, A>::Marray
         this->data_ = 0;
     }
     else {
-        this->data_ = dataAllocator_.allocate(in.size());
+        this->data_ = marray_detail::allocateContiguous(dataAllocator_, in.size(), true);
     }
     if(in.isSimple() && marray_detail::IsEqual<T, TLocal>::type) {
-        memcpy(this->data_, in.data_, (in.size())*sizeof(T));
+        marray_detail::copyContiguous(this->data_, in.data_, in.size(), sizeof(T));
     }
-    else {
-        typename View<TLocal, isConstLocal, ALocal>::const_iterator it = in.begin();
-        for(std::size_t j=0; j<this->size(); ++j, ++it)  {
-            this->data_[j] = static_cast<T>(*it);
-        }
+    else if(in.size() != 0) {
+        marray_detail::operate(*this, in, marray_detail::Assign<T, TLocal>());
     }
 
     testInvariant();
@@ -3010,7 +4360,7 @@ Marray<T, A>::Marray
 ) 
 :   dataAllocator_(allocator)
 {
-    this->data_ = dataAllocator_.allocate(expression.size());
+    this->data_ = marray_detail::allocateContiguous(dataAllocator_, expression.size(), true);
     if(expression.dimension() == 0) {
         this->geometry_ = geometry_type(0, 
             static_cast<const E&>(expression).coordinateOrder(), 
@@ -3063,11 +4413,9 @@ Marray<T, A>::Marray
     std::size_t size = std::accumulate(begin, end, static_cast<std::size_t>(1), 
         std::multiplies<std::size_t>());
     marray_detail::Assert(MARRAY_NO_ARG_TEST || size != 0);
-    base::assign(begin, end, dataAllocator_.allocate(size), coordinateOrder, 
-        coordinateOrder, allocator); 
-    for(std::size_t j=0; j<size; ++j) {
-        this->data_[j] = value;
-    }
+    value_type* data = marray_detail::allocateContiguous(dataAllocator_, size, true);
+    base::assign(begin, end, data, coordinateOrder, coordinateOrder, allocator); 
+    marray_detail::fillContiguous(this->data_, size, value);
     testInvariant();
 }
 
@@ -3097,8 +4445,8 @@ Marray<T, A>::Marray
     std::size_t size = std::accumulate(begin, end, static_cast<std::size_t>(1), 
         std::multiplies<std::size_t>());
     marray_detail::Assert(MARRAY_NO_ARG_TEST || size != 0);
-    base::assign(begin, end, dataAllocator_.allocate(size), coordinateOrder, 
-        coordinateOrder, allocator); 
+    value_type* data = marray_detail::allocateContiguous(dataAllocator_, size, false);
+    base::assign(begin, end, data, coordinateOrder, coordinateOrder, allocator); 
     testInvariant();
 }
 
@@ -3125,9 +4473,10 @@ Marray<T, A>::Marray
     std::size_t size = std::accumulate(shape.begin(), shape.end(), 
         static_cast<std::size_t>(1), std::multiplies<std::size_t>());
     marray_detail::Assert(MARRAY_NO_ARG_TEST || size != 0);
-    base::assign(shape.begin(), shape.end(), dataAllocator_.allocate(size), 
-                 coordinateOrder, coordinateOrder, allocator); 
-    std::fill(this->data_, this->data_+size, value);
+    value_type* data = marray_detail::allocateContiguous(dataAllocator_, size, true);
+    base::assign(shape.begin(), shape.end(), data, coordinateOrder, 
+                 coordinateOrder, allocator); 
+    marray_detail::fillContiguous(this->data_, size, value);
     testInvariant();
 }
 
@@ -3175,10 +4524,10 @@ Marray<T, A>::operator=
             if(this->size() != in.size()) {
                 // re-alloc
                 dataAllocator_.deallocate(this->data_, this->size());
-                this->data_ = dataAllocator_.allocate(in.size());
+                this->data_ = marray_detail::allocateContiguous(dataAllocator_, in.size(), true);
             }
             // copy data
-            memcpy(this->data_, in.data_, in.size() * sizeof(T));
+            marray_detail::copyContiguous(this->data_, in.data_, in.size(), sizeof(T));
         }
         this->geometry_ = in.geometry_;
     }
@@ -3186,6 +4535,62 @@ Marray<T, A>::operator=
     return *this;
 }
 
+/// Move assignment.
+///
+/// The memory allocated for *this is freed, and the data and geometry
+/// of 'in' are taken over without copying. 'in' is left un-initialized.
+///
+/// \param in Marray (source).
+/// 
+template<class T, class A> 
+inline Marray<T, A>&
+Marray<T, A>::operator=
+(
+    Marray<T, A>&& in
+) noexcept
+{
+    if(this != &in) { // no self-assignment
+        dataAllocator_.deallocate(this->data_, this->size());
+        dataAllocator_ = in.dataAllocator_;
+        this->data_ = in.data_;
+        this->geometry_ = std::move(in.geometry_);
+        in.data_ = 0;
+    }
+    return *this;
+}
+
+/// Exchange the data and geometry of two Marrays without copying.
+///
+/// \param in Marray.
+/// 
+template<class T, class A> 
+inline void
+Marray<T, A>::swap
+(
+    Marray<T, A>& in
+) noexcept
+{
+    std::swap(this->data_, in.data_);
+    this->geometry_.swap(in.geometry_);
+    std::swap(dataAllocator_, in.dataAllocator_);
+}
+
+/// Exchange the data and geometry of two Marrays without copying.
+///
+/// \param a Marray.
+/// \param b Marray.
+///
+template<class T, class A> 
+inline void
+swap
+(
+    Marray<T, A>& a,
+    Marray<T, A>& b
+) noexcept
+{
+    a.swap(b);
+}
+
 /// Assignment from View.
 ///
 /// This operator works as follows:
@@ -3219,13 +4624,13 @@ Marray<T, A>::operator=
         }
         else if(this->overlaps(in)) {
             Marray<T, A> m = in; // temporary copy
-            (*this) = m;
+            (*this) = std::move(m);
         }
         else {
             // re-alloc memory if necessary
             if(this->size() != in.size()) {
                 dataAllocator_.deallocate(this->data_, this->size());
-                this->data_ = dataAllocator_.allocate(in.size());
+                this->data_ = marray_detail::allocateContiguous(dataAllocator_, in.size(), true);
             }
 
             // copy geometry
@@ -3241,33 +4646,10 @@ Marray<T, A>::operator=
 
             // copy data
             if(in.isSimple() && marray_detail::IsEqual<T, TLocal>::type) {
-                memcpy(this->data_, in.data_, (in.size())*sizeof(T));
-            }
-            else if(in.dimension() == 1)
-                marray_detail::OperateHelperBinary<1, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 2)
-                marray_detail::OperateHelperBinary<2, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 3)
-                marray_detail::OperateHelperBinary<3, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 4)
-                marray_detail::OperateHelperBinary<4, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 5)
-                marray_detail::OperateHelperBinary<5, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 6)
-                marray_detail::OperateHelperBinary<6, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 7)
-                marray_detail::OperateHelperBinary<7, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 8)
-                marray_detail::OperateHelperBinary<8, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 9)
-                marray_detail::OperateHelperBinary<9, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
-            else if(in.dimension() == 10)
-                marray_detail::OperateHelperBinary<10, marray_detail::Assign<T, TLocal>, T, TLocal, isConstLocal, A, ALocal>::operate(*this, in, marray_detail::Assign<T, TLocal>(), this->data_, &in(0));
+                marray_detail::copyContiguous(this->data_, in.data_, in.size(), sizeof(T));
+            }
             else {
-                typename View<TLocal, isConstLocal, ALocal>::const_iterator it = in.begin();
-                for(std::size_t j=0; j<this->size(); ++j, ++it) {
-                    this->data_[j] = static_cast<T>(*it);
-                }
+                marray_detail::operate(*this, in, marray_detail::Assign<T, TLocal>());
             }
         }
     }
@@ -3289,9 +4671,7 @@ Marray<T, A>::operator=
 )
 {
     marray_detail::Assert(MARRAY_NO_DEBUG || this->data_ != 0);
-    for(std::size_t j=0; j<this->size(); ++j) {
-        this->data_[j] = value;
-    }
+    marray_detail::fillContiguous(this->data_, this->size(), value);
     return *this;
 }
 
@@ -3303,15 +4683,22 @@ Marray<T, A>::operator=
     const ViewExpression<E, Te>& expression
 )
 {
-    if(expression.overlaps(*this)) {
+    // the expression is evaluated in place if its shape is that of the
+    // Marray and it reads each entry of the Marray only to compute the 
+    // same entry, like in a = a * 2 + b
+    const bool sameGeometry = this->data_ != 0
+        && expression.dimension() == this->geometry_.dimension()
+        && std::equal(this->geometry_.shapeBegin(), this->geometry_.shapeEnd(), expression.shapeBegin())
+        && expression.coordinateOrder() == this->geometry_.coordinateOrder();
+    if(sameGeometry ? expression.overlapsOtherEntries(*this) : expression.overlaps(*this)) {
         Marray<T, A> m(expression); // temporary copy
-        (*this) = m; // recursive call
+        (*this) = std::move(m);
     }
     else {
         // re-allocate memory (if necessary)
         if(this->size() != expression.size()) {
             dataAllocator_.deallocate(this->data_, this->size());
-            this->data_ = dataAllocator_.allocate(expression.size());
+            this->data_ = marray_detail::allocateContiguous(dataAllocator_, expression.size(), true);
         }
         
         // copy geometry
@@ -3347,20 +4734,17 @@ Marray<T, A>::resizeHelper
 {   
     testInvariant();
     // compute size
-    std::vector<std::size_t> newShape;
+    marray_detail::SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> newShape(begin, end);
     std::size_t newSize = 1;
-    for(ShapeIterator it = begin; it != end; ++it) {
-        std::size_t x = static_cast<std::size_t>(*it);
-        marray_detail::Assert(MARRAY_NO_ARG_TEST || x > 0);
-        newShape.push_back(x);
-        newSize *= x;
+    for(std::size_t j=0; j<newShape.size(); ++j) {
+        marray_detail::Assert(MARRAY_NO_ARG_TEST || newShape[j] > 0);
+        newSize *= newShape[j];
     }
     // allocate new
-    value_type* newData = dataAllocator_.allocate(newSize); 
+    value_type* newData = marray_detail::allocateContiguous(dataAllocator_, newSize, 
+        !SKIP_INITIALIZATION); 
     if(!SKIP_INITIALIZATION) {
-        for(std::size_t j=0; j<newSize; ++j) {
-            newData[j] = value;
-        }
+        marray_detail::fillContiguous(newData, newSize, value);
     }
     // copy old data in region of overlap
     if(this->data_ != 0) {
@@ -3368,10 +4752,14 @@ Marray<T, A>::resizeHelper
             newData[0] = this->data_[0];
         }
         else {
-            std::vector<std::size_t> base1(this->dimension());
-            std::vector<std::size_t> base2(newShape.size());
-            std::vector<std::size_t> shape1(this->dimension(), 1);
-            std::vector<std::size_t> shape2(newShape.size(), 1);
+            // no heap allocation for up to MARRAY_INLINE_DIMENSION dimensions
+            typedef marray_detail::SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> Coordinates;
+            Coordinates base1(this->dimension());
+            Coordinates base2(newShape.size());
+            Coordinates shape1(this->dimension());
+            Coordinates shape2(newShape.size());
+            std::fill(shape1.begin(), shape1.end(), 1);
+            std::fill(shape2.begin(), shape2.end(), 1);
             for(std::size_t j=0; j<std::min(this->dimension(), newShape.size()); ++j) {
                 shape1[j] = std::min(this->shape(j), newShape[j]);
                 shape2[j] = shape1[j];
@@ -3541,7 +4929,7 @@ inline Iterator<T, isConst, A>::Iterator()
 :   view_(0),
     pointer_(0),
     index_(0),
-    coordinates_(std::vector<std::size_t>())
+    coordinates_()
 {
     testInvariant();
 }
@@ -3560,7 +4948,7 @@ inline Iterator<T, isConst, A>::Iterator
 :   view_(&view),
     pointer_(0),
     index_(index),
-    coordinates_(std::vector<std::size_t>(view.dimension()))
+    coordinates_(view.dimension())
     // Note for developers: If isConst==false, the construction view_(&view)
     // fails due to incompatible types. This is intended because it should 
     // not be possible to construct a mutable iterator on constant data.
@@ -3613,7 +5001,7 @@ inline Iterator<T, isConst, A>::Iterator
 :   view_(reinterpret_cast<view_pointer>(&view)),
     pointer_(0),
     index_(index),
-    coordinates_(std::vector<std::size_t>(view.dimension()))
+    coordinates_(view.dimension())
     // Note for developers: If isConst==true, the construction
     // view_(reinterpret_cast<view_pointer>(&view)) works as well.
     // This is intended because it should be possible to construct 
@@ -3667,7 +5055,7 @@ inline Iterator<T, isConst, A>::Iterator
 :   view_(reinterpret_cast<view_pointer>(&view)),
     pointer_(0),
     index_(index),
-    coordinates_(std::vector<std::size_t>(view.dimension()))
+    coordinates_(view.dimension())
     // Note for developers: If isConst==true, the construction
     // view_(reinterpret_cast<view_pointer>(&view)) works as well.
     // This is intended because it should be possible to construct 
@@ -4134,293 +5522,973 @@ Iterator<T, isConst, A>::coordinate
     }
 }
 
-// implementation of expression templates
+// \cond suppress_doxygen
+namespace marray_detail {
 
-/// Expression template for efficient arithmetic operations.
-template<class E, class T>
-class ViewExpression {
-public:
-    typedef E expression_type;
-    typedef T value_type;
+// conversion of 16-bit floating point numbers
 
-    const std::size_t dimension() const 
-        { return static_cast<const E&>(*this).dimension(); }
-    const std::size_t size() const 
-        { return static_cast<const E&>(*this).size(); }
-    const std::size_t shape(const std::size_t j) const 
-        { return static_cast<const E&>(*this).shape(j); }
-    const std::size_t* shapeBegin() const 
-        { return static_cast<const E&>(*this).shapeBegin(); }
-    const std::size_t* shapeEnd() const 
-        { return static_cast<const E&>(*this).shapeEnd(); }
-    template<class Tv, bool isConst, class A> 
-        bool overlaps(const View<Tv, isConst, A>& v) const
-            { return static_cast<const E&>(*this).overlaps(v); }
-    const CoordinateOrder& coordinateOrder() const 
-        { return static_cast<const E&>(*this).coordinateOrder(); }
-    const bool isSimple() const
-        { return static_cast<const E&>(*this).isSimple(); }
-    template<class Accessor>
-        const T& operator()(Accessor it) const
-            { return static_cast<const E&>(*this)(it); }
-    const T& operator()(const std::size_t c0, const std::size_t c1) const
-        { return static_cast<const E&>(*this)(c0, c1); }
-    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
-        { return static_cast<const E&>(*this)(c0, c1, c2); }
-    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
-        { return static_cast<const E&>(*this)(c0, c1, c2, c3); }
-    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
-        { return static_cast<const E&>(*this)(c0, c1, c2, c3, c4); }
-    const T& operator[](const std::size_t offset) const
-        { return static_cast<const E&>(*this)[offset]; }
-    operator E&() 
-        { return static_cast<E&>(*this); }
-    operator E const&() const 
-        { return static_cast<const E&>(*this); }
+inline std::uint16_t
+floatToHalf
+(
+    const float f
+)
+{
+    std::uint32_t x;
+    std::memcpy(&x, &f, sizeof(float));
+    const std::uint16_t sign = static_cast<std::uint16_t>((x >> 16) & 0x8000u);
+    x &= 0x7fffffffu;
+    if(x >= 0x7f800000u) { // infinity and NaN (which remains quiet)
+        return sign | 0x7c00u | (x > 0x7f800000u ? 0x0200u | ((x >> 13) & 0x03ffu) : 0u);
+    }
+    if(x >= 0x477ff000u) { // rounded beyond the largest number 65504
+        return sign | 0x7c00u;
+    }
+    std::uint32_t h;
+    std::uint32_t remainder;
+    std::uint32_t halfway;
+    if(x < 0x38800000u) { // subnormal numbers, in units of 2^-24
+        if(x < 0x33000000u) {
+            return sign;
+        }
+        const std::uint32_t shift = 126 - (x >> 23);
+        const std::uint32_t mantissa = (x & 0x007fffffu) | 0x00800000u;
+        h = mantissa >> shift;
+        remainder = mantissa & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    }
+    else {
+        h = (x - 0x38000000u) >> 13; // exponent bias 127 - 15
+        remainder = x & 0x1fffu;
+        halfway = 0x1000u;
+    }
+    if(remainder > halfway || (remainder == halfway && (h & 1u))) {
+        ++h; // the carry may increment the exponent
+    }
+    return sign | static_cast<std::uint16_t>(h);
+}
 
-    // \cond suppress_doxygen
-    class ExpressionIterator {
-    public:
-        ExpressionIterator(const ViewExpression<E, T>& expression)
-        : expression_(expression), // cast!
-          data_(&expression_(0)),
-          offset_(0)
-            {}
-        void incrementCoordinate(const std::size_t coordinateIndex)
-            { offset_ += expression_.strides(coordinateIndex); }
-        void resetCoordinate(const std::size_t coordinateIndex)
-            { offset_ -= expression_.strides(coordinateIndex)
+inline float
+halfToFloat
+(
+    const std::uint16_t h
+)
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+    const std::uint32_t exponent = (h >> 10) & 0x1fu;
+    const std::uint32_t mantissa = h & 0x03ffu;
+    std::uint32_t x;
+    if(exponent == 0x1fu) {
+        x = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else if(exponent != 0) {
+        x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    else { // zero and subnormal numbers
+        const float f = static_cast<float>(mantissa) * 5.9604644775390625e-8f; // 2^-24
+        std::memcpy(&x, &f, sizeof(float));
+        x |= sign;
+    }
+    float f;
+    std::memcpy(&f, &x, sizeof(float));
+    return f;
+}
 
-                         * (expression_.shape(coordinateIndex) - 1); }
-        const T& operator*() const
-            { // return expression_[offset_]; 
-              // would require making this nested class a friend of View
-              // which in turn would require a forward declaration of 
-              // this class. work around:
-              return data_[offset_]; }
-    private:
-        const E& expression_;
-        const T* data_;
-        std::size_t offset_;
-    };
-    // \endcond suppress_doxygen
-};
+inline std::uint16_t
+floatToBFloat16
+(
+    const float f
+)
+{
+    std::uint32_t x;
+    std::memcpy(&x, &f, sizeof(float));
+    if((x & 0x7fffffffu) > 0x7f800000u) { // NaN remains quiet
+        return static_cast<std::uint16_t>((x >> 16) | 0x0040u);
+    }
+    x += 0x7fffu + ((x >> 16) & 1u); // round to nearest, ties to even
+    return static_cast<std::uint16_t>(x >> 16);
+}
 
-// \cond suppress_doxygen
-template<class E, class T, class UnaryFunctor>
-class UnaryViewExpression 
-: public ViewExpression<UnaryViewExpression<E, T, UnaryFunctor>, T> 
+inline float
+bfloat16ToFloat
+(
+    const std::uint16_t h
+)
 {
-public:
-    typedef E expression_type;
-    typedef T value_type;
+    const std::uint32_t x = static_cast<std::uint32_t>(h) << 16;
+    float f;
+    std::memcpy(&f, &x, sizeof(float));
+    return f;
+}
 
-    UnaryViewExpression(const ViewExpression<E, T>& e)
-        : e_(e), // cast!
-          unaryFunctor_(UnaryFunctor()) 
-        {}
-    const std::size_t dimension() const 
-        { return e_.dimension(); }
-    const std::size_t size() const 
-        { return e_.size(); }
-    const std::size_t shape(const std::size_t j) const 
-        { return e_.shape(j); }
-    const std::size_t* shapeBegin() const 
-        { return e_.shapeBegin(); }
-    const std::size_t* shapeEnd() const 
-        { return e_.shapeEnd(); }
-    template<class Tv, bool isConst, class A> 
-        bool overlaps(const View<Tv, isConst, A>& v) const
-            { return e_.overlaps(v); }
-    const CoordinateOrder& coordinateOrder() const 
-        { return e_.coordinateOrder(); }
-    const bool isSimple() const
-        { return e_.isSimple(); }
-    template<class Accessor>
-        const T operator()(Accessor it) const
-            { return unaryFunctor_(e_(it)); }
-    const T operator()(const std::size_t c0, const std::size_t c1) const
-        { return unaryFunctor_(e_(c0, c1)); }
-    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2) const 
-        { return unaryFunctor_(e_(c0, c1, c2)); }
-    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2, const std::size_t c3) const 
-        { return unaryFunctor_(e_(c0, c1, c2, c3)); }
-    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
-        { return unaryFunctor_(e_(c0, c1, c2, c3, c4)); }
-    const T operator[](const std::size_t offset) const
-        { return unaryFunctor_(e_[offset]); }
+// contiguous conversion between float and 16-bit floating point numbers.
+// The loops over BFloat16 consist of integer operations that are 
+// vectorized by the compiler. Float16 is converted by the F16C 
+// instructions if the processor supports them.
 
-    class ExpressionIterator {
-    public:
-        ExpressionIterator(const UnaryViewExpression<E, T, UnaryFunctor>& expression)
-        : unaryFunctor_(expression.unaryFunctor_),
-          iterator_(expression.e_)
-            {}
-        void incrementCoordinate(const std::size_t coordinateIndex)
-            { iterator_.incrementCoordinate(coordinateIndex); } 
-        void resetCoordinate(const std::size_t coordinateIndex)
-            { iterator_.resetCoordinate(coordinateIndex); }
-        const T operator*() const
-            { return unaryFunctor_(*iterator_); }
-    private:
-        UnaryFunctor unaryFunctor_;
-        typename E::ExpressionIterator iterator_;
-    };
+#ifdef MARRAY_SIMD_X86
+inline bool
+hasF16C()
+{
+    static const bool f16c = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    return f16c;
+}
 
-private:
-    const E& e_;
-    UnaryFunctor unaryFunctor_;
-};
+__attribute__((target("avx,f16c"))) inline std::size_t
+convertF16C
+(
+    float* out,
+    const Float16* in,
+    const std::size_t size
+)
+{
+    std::size_t j = 0;
+    for(; j+8 <= size; j += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + j));
+        _mm256_storeu_ps(out + j, _mm256_cvtph_ps(h));
+    }
+    return j;
+}
 
-template<class E1, class T1, class E2, class T2, class BinaryFunctor>
-class BinaryViewExpression
-: public ViewExpression<BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>, 
-                        typename marray_detail::PromoteType<T1, T2>::type>
+__attribute__((target("avx,f16c"))) inline std::size_t
+convertF16C
+(
+    Float16* out,
+    const float* in,
+    const std::size_t size
+)
 {
-public:
-    typedef E1 expression_type_1;
-    typedef E2 expression_type_2;
-    typedef T1 value_type_1;
-    typedef T2 value_type_2;
-    typedef typename marray_detail::PromoteType<T1, T2>::type value_type;
-    typedef BinaryFunctor functor_type;
-    typedef ViewExpression<BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>, 
-        value_type> base;
+    std::size_t j = 0;
+    for(; j+8 <= size; j += 8) {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + j), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), h);
+    }
+    return j;
+}
+#endif
 
-    BinaryViewExpression(const ViewExpression<E1, T1>& e1, 
-        const ViewExpression<E2, T2>& e2) 
-        : e1_(e1), e2_(e2), // cast!
-          binaryFunctor_(BinaryFunctor()) 
-        {
-            if(!MARRAY_NO_DEBUG) {
-                marray_detail::Assert(e1_.size() != 0 && e2_.size() != 0);
-                marray_detail::Assert(e1_.dimension() == e2_.dimension());
-                for(std::size_t j=0; j<e1_.dimension(); ++j) {
-                    marray_detail::Assert(e1_.shape(j) == e2_.shape(j));
-                }
-            }
-        }
-    const std::size_t dimension() const 
-        { return e1_.dimension() < e2_.dimension() ? e2_.dimension() : e1_.dimension(); }
-    const std::size_t size() const 
-        { return e1_.size() < e2_.size() ? e2_.size() : e1_.size(); }
-    const std::size_t shape(const std::size_t j) const 
-        { return e1_.dimension() < e2_.dimension() ? e2_.shape(j) : e1_.shape(j); }
-    const std::size_t* shapeBegin() const 
-        { return e1_.dimension() < e2_.dimension() ? e2_.shapeBegin() : e1_.shapeBegin(); }
-    const std::size_t* shapeEnd() const 
-        { return e1_.dimension() < e2_.dimension() ? e2_.shapeEnd() : e1_.shapeEnd(); }
-    template<class Tv, bool isConst, class A> 
-        bool overlaps(const View<Tv, isConst, A>& v) const
-            { return e1_.overlaps(v) || e2_.overlaps(v); }
-    const CoordinateOrder& coordinateOrder() const 
-        { return e1_.coordinateOrder(); }
-    const bool isSimple() const
-        { return e1_.isSimple() && e2_.isSimple() 
-                 && e1_.coordinateOrder() == e2_.coordinateOrder(); }
-    template<class Accessor>
-        const value_type operator()(Accessor it) const
-            { return binaryFunctor_(e1_(it), e2_(it)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1) const
-        { return binaryFunctor_(e1_(c0, c1), e2_(c0, c1)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
-        { return binaryFunctor_(e1_(c0, c1, c2), e2_(c0, c1, c2)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
-        { return binaryFunctor_(e1_(c0, c1, c2, c3), e2_(c0, c1, c2, c3)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
-        { return binaryFunctor_(e1_(c0, c1, c2, c3, c4), e2_(c0, c1, c2, c3, c4)); }
-    const value_type operator[](const std::size_t offset) const
-        { return binaryFunctor_(e1_[offset], e2_[offset]); }
+inline void 
+operateContiguous
+(
+    float* dataV,
+    const Float16* dataW,
+    const std::size_t size,
+    Assign<float, Float16>
+)
+{
+    std::size_t j = 0;
+#ifdef MARRAY_SIMD_X86
+    if(hasF16C()) {
+        j = convertF16C(dataV, dataW, size);
+    }
+#endif
+    for(; j<size; ++j) {
+        dataV[j] = halfToFloat(dataW[j].bits());
+    }
+}
 
-    class ExpressionIterator {
-    public:
-        ExpressionIterator(const BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>& expression)
-        : binaryFunctor_(expression.binaryFunctor_),
-          iterator1_(expression.e1_), 
-          iterator2_(expression.e2_)
-            {}
-        void incrementCoordinate(const std::size_t coordinateIndex)
-            {   iterator1_.incrementCoordinate(coordinateIndex); 
-                iterator2_.incrementCoordinate(coordinateIndex); }
-        void resetCoordinate(const std::size_t coordinateIndex)
-            {   iterator1_.resetCoordinate(coordinateIndex); 
-                iterator2_.resetCoordinate(coordinateIndex); }
-        const value_type operator*() const
-            { return binaryFunctor_(*iterator1_, *iterator2_); }
-    private:
-        BinaryFunctor binaryFunctor_;
-        typename E1::ExpressionIterator iterator1_;
-        typename E2::ExpressionIterator iterator2_;
-    };
+inline void 
+operateContiguous
+(
+    Float16* dataV,
+    const float* dataW,
+    const std::size_t size,
+    Assign<Float16, float>
+)
+{
+    std::size_t j = 0;
+#ifdef MARRAY_SIMD_X86
+    if(hasF16C()) {
+        j = convertF16C(dataV, dataW, size);
+    }
+#endif
+    for(; j<size; ++j) {
+        dataV[j] = Float16(dataW[j]);
+    }
+}
 
-private:
-    const expression_type_1& e1_;
-    const expression_type_2& e2_;
-    BinaryFunctor binaryFunctor_;
-};
+inline void 
+operateContiguous
+(
+    float* dataV,
+    const BFloat16* dataW,
+    const std::size_t size,
+    Assign<float, BFloat16>
+)
+{
+    for(std::size_t j=0; j<size; ++j) {
+        dataV[j] = bfloat16ToFloat(dataW[j].bits());
+    }
+}
 
-template<class E, class T, class S, class BinaryFunctor>
-class BinaryViewExpressionScalarFirst
-: public ViewExpression<BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>, 
-                        typename marray_detail::PromoteType<T, S>::type> {
+inline void 
+operateContiguous
+(
+    BFloat16* dataV,
+    const float* dataW,
+    const std::size_t size,
+    Assign<BFloat16, float>
+)
+{
+    for(std::size_t j=0; j<size; ++j) {
+        dataV[j] = BFloat16::fromBits(floatToBFloat16(dataW[j]));
+    }
+}
+
+} // namespace marray_detail
+// \endcond suppress_doxygen
+
+// implementation of Float16 and BFloat16
+
+inline 
+Float16::Float16()
+:   bits_(0)
+{}
+
+/// Round a float to the nearest Float16 (ties to even).
+///
+inline 
+Float16::Float16
+(
+    const float x
+)
+:   bits_(marray_detail::floatToHalf(x))
+{}
+
+inline 
+Float16::operator float() const
+{
+    return marray_detail::halfToFloat(bits_);
+}
+
+/// Float16 with a given binary representation.
+///
+inline Float16
+Float16::fromBits
+(
+    const std::uint16_t bits
+)
+{
+    Float16 x;
+    x.bits_ = bits;
+    return x;
+}
+
+/// Binary representation.
+///
+inline std::uint16_t
+Float16::bits() const
+{
+    return bits_;
+}
+
+inline Float16& 
+Float16::operator+=
+(
+    const float y
+)
+{
+    *this = Float16(static_cast<float>(*this) + y);
+    return *this;
+}
+
+inline Float16& 
+Float16::operator-=
+(
+    const float y
+)
+{
+    *this = Float16(static_cast<float>(*this) - y);
+    return *this;
+}
+
+inline Float16& 
+Float16::operator*=
+(
+    const float y
+)
+{
+    *this = Float16(static_cast<float>(*this) * y);
+    return *this;
+}
+
+inline Float16& 
+Float16::operator/=
+(
+    const float y
+)
+{
+    *this = Float16(static_cast<float>(*this) / y);
+    return *this;
+}
+
+inline Float16& 
+Float16::operator++()
+{
+    return (*this) += 1.0f;
+}
+
+inline Float16& 
+Float16::operator--()
+{
+    return (*this) -= 1.0f;
+}
+
+inline Float16 
+Float16::operator++(int)
+{
+    Float16 copy = *this;
+    (*this) += 1.0f;
+    return copy;
+}
+
+inline Float16 
+Float16::operator--(int)
+{
+    Float16 copy = *this;
+    (*this) -= 1.0f;
+    return copy;
+}
+
+inline 
+BFloat16::BFloat16()
+:   bits_(0)
+{}
+
+/// Round a float to the nearest BFloat16 (ties to even).
+///
+inline 
+BFloat16::BFloat16
+(
+    const float x
+)
+:   bits_(marray_detail::floatToBFloat16(x))
+{}
+
+inline 
+BFloat16::operator float() const
+{
+    return marray_detail::bfloat16ToFloat(bits_);
+}
+
+/// BFloat16 with a given binary representation.
+///
+inline BFloat16
+BFloat16::fromBits
+(
+    const std::uint16_t bits
+)
+{
+    BFloat16 x;
+    x.bits_ = bits;
+    return x;
+}
+
+/// Binary representation.
+///
+inline std::uint16_t
+BFloat16::bits() const
+{
+    return bits_;
+}
+
+inline BFloat16& 
+BFloat16::operator+=
+(
+    const float y
+)
+{
+    *this = BFloat16(static_cast<float>(*this) + y);
+    return *this;
+}
+
+inline BFloat16& 
+BFloat16::operator-=
+(
+    const float y
+)
+{
+    *this = BFloat16(static_cast<float>(*this) - y);
+    return *this;
+}
+
+inline BFloat16& 
+BFloat16::operator*=
+(
+    const float y
+)
+{
+    *this = BFloat16(static_cast<float>(*this) * y);
+    return *this;
+}
+
+inline BFloat16& 
+BFloat16::operator/=
+(
+    const float y
+)
+{
+    *this = BFloat16(static_cast<float>(*this) / y);
+    return *this;
+}
+
+inline BFloat16& 
+BFloat16::operator++()
+{
+    return (*this) += 1.0f;
+}
+
+inline BFloat16& 
+BFloat16::operator--()
+{
+    return (*this) -= 1.0f;
+}
+
+inline BFloat16 
+BFloat16::operator++(int)
+{
+    BFloat16 copy = *this;
+    (*this) += 1.0f;
+    return copy;
+}
+
+inline BFloat16 
+BFloat16::operator--(int)
+{
+    BFloat16 copy = *this;
+    (*this) -= 1.0f;
+    return copy;
+}
+
+// implementation of expression templates
+
+/// Expression template for efficient arithmetic operations.
+template<class E, class T>
+class ViewExpression {
 public:
     typedef E expression_type;
-    typedef T value_type_1;
-    typedef S scalar_type;
-    typedef typename marray_detail::PromoteType<T, S>::type value_type;
-    typedef BinaryFunctor functor_type;
-    typedef ViewExpression<BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>, 
-        value_type> base;
+    typedef T value_type;
 
-    BinaryViewExpressionScalarFirst(const ViewExpression<E, T>& e, 
-        const scalar_type& scalar) 
-        : e_(e), // cast!
-          scalar_(scalar), binaryFunctor_(BinaryFunctor()) 
-        { }
     const std::size_t dimension() const 
-        { return e_.dimension(); }
+        { return static_cast<const E&>(*this).dimension(); }
     const std::size_t size() const 
-        { return e_.size(); }
+        { return static_cast<const E&>(*this).size(); }
     const std::size_t shape(const std::size_t j) const 
-        { return e_.shape(j); }
+        { return static_cast<const E&>(*this).shape(j); }
     const std::size_t* shapeBegin() const 
-        { return e_.shapeBegin(); }
+        { return static_cast<const E&>(*this).shapeBegin(); }
     const std::size_t* shapeEnd() const 
-        { return e_.shapeEnd(); }
+        { return static_cast<const E&>(*this).shapeEnd(); }
     template<class Tv, bool isConst, class A> 
         bool overlaps(const View<Tv, isConst, A>& v) const
-            { return e_.overlaps(v); }
+            { return static_cast<const E&>(*this).overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return static_cast<const E&>(*this).overlapsOtherEntries(v); }
     const CoordinateOrder& coordinateOrder() const 
-        { return e_.coordinateOrder(); }
+        { return static_cast<const E&>(*this).coordinateOrder(); }
     const bool isSimple() const
-        { return e_.isSimple(); }
+        { return static_cast<const E&>(*this).isSimple(); }
     template<class Accessor>
-        const value_type operator()(Accessor it) const
-            { return binaryFunctor_(scalar_, e_(it)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1) const
-        { return binaryFunctor_(scalar_, e_(c0, c1)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
-        { return binaryFunctor_(scalar_, e_(c0, c1, c2)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
-        { return binaryFunctor_(scalar_, e_(c0, c1, c2, c3)); }
-    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
-        { return binaryFunctor_(scalar_, e_(c0, c1, c2, c3, c4)); }
-    const value_type operator[](const std::size_t offset) const
-        { return binaryFunctor_(scalar_, e_[offset]); }
+        const T& operator()(Accessor it) const
+            { return static_cast<const E&>(*this)(it); }
+    const T& operator()(const std::size_t c0, const std::size_t c1) const
+        { return static_cast<const E&>(*this)(c0, c1); }
+    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
+        { return static_cast<const E&>(*this)(c0, c1, c2); }
+    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
+        { return static_cast<const E&>(*this)(c0, c1, c2, c3); }
+    const T& operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
+        { return static_cast<const E&>(*this)(c0, c1, c2, c3, c4); }
+    const T& operator[](const std::size_t offset) const
+        { return static_cast<const E&>(*this)[offset]; }
+    operator E&() 
+        { return static_cast<E&>(*this); }
+    operator E const&() const 
+        { return static_cast<const E&>(*this); }
+
+    // \cond suppress_doxygen
+    // expressions that are vectorizable provide a member function 
+    // vectorAt(offset, x) that yields the entries offset, offset+1, ... 
+    // of a simple expression as a vector x, cf. marray_detail::simdEvaluate().
+    // expressions are not vectorizable unless they declare otherwise.
+    // for comparisons, vector_value_type is the type of the operands, and
+    // the vectors hold masks of all bits set or unset
+    typedef T vector_value_type;
+    static const bool vectorizable = false;
 
     class ExpressionIterator {
     public:
-        ExpressionIterator(const BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>& expression)
-        : binaryFunctor_(expression.binaryFunctor_),
-          scalar_(expression.scalar_),
-          iterator_(expression.e_)
+        ExpressionIterator(const ViewExpression<E, T>& expression)
+        : data_(&expression(0)),
+          offset_(0),
+          shape_(expression.shapeBegin()),
+          strides_(static_cast<const E&>(expression).stridesBegin()),
+          broadcastStrides_(),
+          rowStride_(0)
             {}
-        void incrementCoordinate(const std::size_t coordinateIndex)
-            { iterator_.incrementCoordinate(coordinateIndex); }
-        void resetCoordinate(const std::size_t coordinateIndex)
+        // traverses the expression broadcast to a shape, cf. 
+        // View::broadcastedView(). missing and singleton dimensions 
+        // have stride 0.
+        ExpressionIterator(const ViewExpression<E, T>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : data_(&expression(0)),
+          offset_(0),
+          shape_(shape),
+          strides_(static_cast<const E&>(expression).stridesBegin()),
+          broadcastStrides_(),
+          rowStride_(0)
+            {
+                const std::size_t skip = dimension - expression.dimension();
+                if(skip != 0 || !std::equal(shape, shape + dimension, expression.shapeBegin())) {
+                    broadcastStrides_ = marray_detail::SmallVector<std::size_t, 
+                        MARRAY_INLINE_DIMENSION>(dimension);
+                    for(std::size_t j=skip; j<dimension; ++j) {
+                        if(expression.shape(j - skip) != 1) {
+                            broadcastStrides_[j] = strides_[j - skip];
+                        }
+                    }
+                    strides_ = broadcastStrides_.begin();
+                }
+            }
+        ExpressionIterator(const ExpressionIterator& other)
+        : data_(other.data_),
+          offset_(other.offset_),
+          shape_(other.shape_),
+          strides_(other.strides_),
+          broadcastStrides_(other.broadcastStrides_),
+          rowStride_(other.rowStride_)
+            {
+                if(broadcastStrides_.size() != 0) {
+                    strides_ = broadcastStrides_.begin();
+                }
+            }
+        void incrementCoordinate(const std::size_t coordinateIndex)
+            { offset_ += strides_[coordinateIndex]; }
+        void resetCoordinate(const std::size_t coordinateIndex)
+            { offset_ -= strides_[coordinateIndex] * (shape_[coordinateIndex] - 1); }
+        const T& operator*() const
+            { // return expression_[offset_]; 
+              // would require making this nested class a friend of View
+              // which in turn would require a forward declaration of 
+              // this class. work around:
+              return data_[offset_]; }
+        // access to the row along the dimension set by setRowDimension() 
+        // that starts at the current position, cf. marray_detail::operateSerial(). 
+        // Entries of a row are contiguous in memory or, if broadcast, all the same.
+        void setRowDimension(const std::size_t rowDimension)
+            { rowStride_ = strides_[rowDimension]; }
+        const T& at(const std::size_t k) const
+            { return data_[offset_ + k * rowStride_]; }
+        bool isContiguous() const
+            { return rowStride_ <= 1; }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   if(rowStride_ == 0) {
+                        x = V() + data_[offset_];
+                    }
+                    else {
+                        std::memcpy(&x, data_ + offset_ + k, sizeof(V));
+                    } }
+    private:
+        const T* data_;
+        std::size_t offset_;
+        const std::size_t* shape_;
+        const std::size_t* strides_;
+        marray_detail::SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> broadcastStrides_;
+        std::size_t rowStride_;
+    };
+    // \endcond suppress_doxygen
+};
+
+// \cond suppress_doxygen
+template<class E, class T, class UnaryFunctor>
+class UnaryViewExpression 
+: public ViewExpression<UnaryViewExpression<E, T, UnaryFunctor>, T> 
+{
+public:
+    typedef E expression_type;
+    typedef T value_type;
+
+    UnaryViewExpression(const ViewExpression<E, T>& e)
+        : e_(e), // cast!
+          unaryFunctor_(UnaryFunctor()) 
+        {}
+    const std::size_t dimension() const 
+        { return e_.dimension(); }
+    const std::size_t size() const 
+        { return e_.size(); }
+    const std::size_t shape(const std::size_t j) const 
+        { return e_.shape(j); }
+    const std::size_t* shapeBegin() const 
+        { return e_.shapeBegin(); }
+    const std::size_t* shapeEnd() const 
+        { return e_.shapeEnd(); }
+    template<class Tv, bool isConst, class A> 
+        bool overlaps(const View<Tv, isConst, A>& v) const
+            { return e_.overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return e_.overlapsOtherEntries(v); }
+    const CoordinateOrder& coordinateOrder() const 
+        { return e_.coordinateOrder(); }
+    const bool isSimple() const
+        { return e_.isSimple(); }
+    template<class Accessor>
+        const T operator()(Accessor it) const
+            { return unaryFunctor_(e_(it)); }
+    const T operator()(const std::size_t c0, const std::size_t c1) const
+        { return unaryFunctor_(e_(c0, c1)); }
+    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2) const 
+        { return unaryFunctor_(e_(c0, c1, c2)); }
+    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2, const std::size_t c3) const 
+        { return unaryFunctor_(e_(c0, c1, c2, c3)); }
+    const T operator()(const std::size_t c0, const std::size_t c1,const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
+        { return unaryFunctor_(e_(c0, c1, c2, c3, c4)); }
+    const T operator[](const std::size_t offset) const
+        { return unaryFunctor_(e_[offset]); }
+    typedef T vector_value_type;
+    static const bool vectorizable = E::vectorizable 
+        && marray_detail::IsEqual<typename E::vector_value_type, T>::type
+        && marray_detail::SimdExpressionFunctor<UnaryFunctor>::supported;
+    template<class V>
+        void vectorAt(const std::size_t offset, V& x) const
+            {   e_.vectorAt(offset, x); 
+                marray_detail::SimdExpressionFunctor<UnaryFunctor>::apply(x); }
+
+    class ExpressionIterator {
+    public:
+        ExpressionIterator(const UnaryViewExpression<E, T, UnaryFunctor>& expression)
+        : unaryFunctor_(expression.unaryFunctor_),
+          iterator_(expression.e_)
+            {}
+        ExpressionIterator(const UnaryViewExpression<E, T, UnaryFunctor>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : unaryFunctor_(expression.unaryFunctor_),
+          iterator_(expression.e_, dimension, shape)
+            {}
+        void incrementCoordinate(const std::size_t coordinateIndex)
+            { iterator_.incrementCoordinate(coordinateIndex); } 
+        void resetCoordinate(const std::size_t coordinateIndex)
             { iterator_.resetCoordinate(coordinateIndex); }
+        void setRowDimension(const std::size_t rowDimension)
+            { iterator_.setRowDimension(rowDimension); }
         const T operator*() const
+            { return unaryFunctor_(*iterator_); }
+        const T at(const std::size_t k) const
+            { return unaryFunctor_(iterator_.at(k)); }
+        bool isContiguous() const
+            { return iterator_.isContiguous(); }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   iterator_.vectorAt(k, x); 
+                    marray_detail::SimdExpressionFunctor<UnaryFunctor>::apply(x); }
+    private:
+        UnaryFunctor unaryFunctor_;
+        typename E::ExpressionIterator iterator_;
+    };
+
+private:
+    const E& e_;
+    UnaryFunctor unaryFunctor_;
+};
+
+template<class E1, class T1, class E2, class T2, class BinaryFunctor>
+class BinaryViewExpression
+: public ViewExpression<BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>, 
+                        typename marray_detail::BinaryResultType<BinaryFunctor, 
+                            typename marray_detail::PromoteType<T1, T2>::type>::type>
+{
+public:
+    typedef E1 expression_type_1;
+    typedef E2 expression_type_2;
+    typedef T1 value_type_1;
+    typedef T2 value_type_2;
+    typedef typename marray_detail::PromoteType<T1, T2>::type vector_value_type;
+    typedef typename marray_detail::BinaryResultType<BinaryFunctor, 
+        vector_value_type>::type value_type;
+    typedef BinaryFunctor functor_type;
+    typedef ViewExpression<BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>, 
+        value_type> base;
+
+    // The shapes of the operands are aligned at the last dimension. 
+    // Missing dimensions and singleton dimensions of one operand are 
+    // broadcast to the shape of the other (as in NumPy).
+    BinaryViewExpression(const ViewExpression<E1, T1>& e1, 
+        const ViewExpression<E2, T2>& e2) 
+        : e1_(e1), e2_(e2), // cast!
+          binaryFunctor_(BinaryFunctor()),
+          broadcasting_(false),
+          shape_(),
+          size_(0)
+        {
+            if(!MARRAY_NO_DEBUG) {
+                marray_detail::Assert(e1_.size() != 0 && e2_.size() != 0);
+            }
+            if(e1_.dimension() != e2_.dimension()
+            || !std::equal(e1_.shapeBegin(), e1_.shapeEnd(), e2_.shapeBegin())) {
+                broadcasting_ = true;
+                const std::size_t dimension = std::max(e1_.dimension(), e2_.dimension());
+                const std::size_t skip1 = dimension - e1_.dimension();
+                const std::size_t skip2 = dimension - e2_.dimension();
+                shape_.resize(dimension);
+                size_ = 1;
+                for(std::size_t j=0; j<dimension; ++j) {
+                    const std::size_t s1 = (j < skip1 ? 1 : e1_.shape(j - skip1));
+                    const std::size_t s2 = (j < skip2 ? 1 : e2_.shape(j - skip2));
+                    if(!MARRAY_NO_ARG_TEST) {
+                        marray_detail::Assert(s1 == s2 || s1 == 1 || s2 == 1);
+                    }
+                    shape_[j] = std::max(s1, s2);
+                    size_ *= shape_[j];
+                }
+            }
+        }
+    const std::size_t dimension() const 
+        { return broadcasting_ ? shape_.size() : e1_.dimension(); }
+    const std::size_t size() const 
+        { return broadcasting_ ? size_ : e1_.size(); }
+    const std::size_t shape(const std::size_t j) const 
+        { return broadcasting_ ? shape_[j] : e1_.shape(j); }
+    const std::size_t* shapeBegin() const 
+        { return broadcasting_ ? shape_.data() : e1_.shapeBegin(); }
+    const std::size_t* shapeEnd() const 
+        { return broadcasting_ ? shape_.data() + shape_.size() : e1_.shapeEnd(); }
+    template<class Tv, bool isConst, class A> 
+        bool overlaps(const View<Tv, isConst, A>& v) const
+            { return e1_.overlaps(v) || e2_.overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return e1_.overlapsOtherEntries(v) || e2_.overlapsOtherEntries(v); }
+    const CoordinateOrder& coordinateOrder() const 
+        { return e1_.coordinateOrder(); }
+    const bool isSimple() const
+        { return !broadcasting_ && e1_.isSimple() && e2_.isSimple() 
+                 && e1_.coordinateOrder() == e2_.coordinateOrder(); }
+    template<class Accessor>
+        const value_type operator()(Accessor it) const
+            { 
+                if(broadcasting_) {
+                    return broadcastAccess(it, std::integral_constant<bool, 
+                        std::numeric_limits<Accessor>::is_integer>());
+                }
+                else {
+                    return binaryFunctor_(e1_(it), e2_(it)); 
+                }
+            }
+    const value_type operator()(const std::size_t c0, const std::size_t c1) const
+        { 
+            if(broadcasting_) {
+                const std::size_t c[] = {c0, c1};
+                return (*this)(&c[0]);
+            }
+            return binaryFunctor_(e1_(c0, c1), e2_(c0, c1)); 
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
+        { 
+            if(broadcasting_) {
+                const std::size_t c[] = {c0, c1, c2};
+                return (*this)(&c[0]);
+            }
+            return binaryFunctor_(e1_(c0, c1, c2), e2_(c0, c1, c2)); 
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
+        { 
+            if(broadcasting_) {
+                const std::size_t c[] = {c0, c1, c2, c3};
+                return (*this)(&c[0]);
+            }
+            return binaryFunctor_(e1_(c0, c1, c2, c3), e2_(c0, c1, c2, c3)); 
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
+        { 
+            if(broadcasting_) {
+                const std::size_t c[] = {c0, c1, c2, c3, c4};
+                return (*this)(&c[0]);
+            }
+            return binaryFunctor_(e1_(c0, c1, c2, c3, c4), e2_(c0, c1, c2, c3, c4)); 
+        }
+    const value_type operator[](const std::size_t offset) const
+        { return binaryFunctor_(e1_[offset], e2_[offset]); }
+    static const bool vectorizable = E1::vectorizable && E2::vectorizable
+        && marray_detail::IsEqual<T1, T2>::type
+        && marray_detail::IsEqual<typename E1::vector_value_type, T1>::type
+        && marray_detail::IsEqual<typename E2::vector_value_type, T2>::type
+        && marray_detail::SimdExpressionFunctor<BinaryFunctor>::supported;
+    template<class V>
+        void vectorAt(const std::size_t offset, V& x) const
+            {   V y;
+                e1_.vectorAt(offset, x); 
+                e2_.vectorAt(offset, y); 
+                marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
+
+    class ExpressionIterator {
+    public:
+        // both operands are traversed as broadcast to the shape of the
+        // expression, cf. the iterator of ViewExpression
+        ExpressionIterator(const BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>& expression)
+        : binaryFunctor_(expression.binaryFunctor_),
+          iterator1_(expression.e1_, expression.dimension(), expression.shapeBegin()), 
+          iterator2_(expression.e2_, expression.dimension(), expression.shapeBegin())
+            {}
+        ExpressionIterator(const BinaryViewExpression<E1, T1, E2, T2, BinaryFunctor>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : binaryFunctor_(expression.binaryFunctor_),
+          iterator1_(expression.e1_, dimension, shape), 
+          iterator2_(expression.e2_, dimension, shape)
+            {}
+        void incrementCoordinate(const std::size_t coordinateIndex)
+            {   iterator1_.incrementCoordinate(coordinateIndex); 
+                iterator2_.incrementCoordinate(coordinateIndex); }
+        void resetCoordinate(const std::size_t coordinateIndex)
+            {   iterator1_.resetCoordinate(coordinateIndex); 
+                iterator2_.resetCoordinate(coordinateIndex); }
+        void setRowDimension(const std::size_t rowDimension)
+            {   iterator1_.setRowDimension(rowDimension); 
+                iterator2_.setRowDimension(rowDimension); }
+        const value_type operator*() const
+            { return binaryFunctor_(*iterator1_, *iterator2_); }
+        const value_type at(const std::size_t k) const
+            { return binaryFunctor_(iterator1_.at(k), iterator2_.at(k)); }
+        bool isContiguous() const
+            { return iterator1_.isContiguous() && iterator2_.isContiguous(); }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   V y;
+                    iterator1_.vectorAt(k, x); 
+                    iterator2_.vectorAt(k, y); 
+                    marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
+    private:
+        BinaryFunctor binaryFunctor_;
+        typename E1::ExpressionIterator iterator1_;
+        typename E2::ExpressionIterator iterator2_;
+    };
+
+private:
+    template<class CoordinateIterator>
+        const value_type broadcastAccess(CoordinateIterator it, std::false_type) const
+            {
+                typedef marray_detail::BroadcastCoordinateIterator<CoordinateIterator> Iterator;
+                return binaryFunctor_(
+                    e1_(Iterator(it, shape_.size() - e1_.dimension(), e1_.shapeBegin(), e1_.dimension())), 
+                    e2_(Iterator(it, shape_.size() - e2_.dimension(), e2_.shapeBegin(), e2_.dimension())));
+            }
+    template<class Index>
+        const value_type broadcastAccess(Index index, std::true_type) const
+            {
+                std::vector<std::size_t> c(shape_.size());
+                std::size_t r = static_cast<std::size_t>(index);
+                for(std::size_t k=0; k<shape_.size(); ++k) {
+                    const std::size_t j = (coordinateOrder() == FirstMajorOrder ? shape_.size() - 1 - k : k);
+                    c[j] = r % shape_[j];
+                    r /= shape_[j];
+                }
+                return broadcastAccess(c.begin(), std::false_type());
+            }
+
+    const expression_type_1& e1_;
+    const expression_type_2& e2_;
+    BinaryFunctor binaryFunctor_;
+    bool broadcasting_;
+    std::vector<std::size_t> shape_;
+    std::size_t size_;
+};
+
+template<class E, class T, class S, class BinaryFunctor>
+class BinaryViewExpressionScalarFirst
+: public ViewExpression<BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>, 
+                        typename marray_detail::BinaryResultType<BinaryFunctor, 
+                            typename marray_detail::PromoteType<T, S>::type>::type> {
+public:
+    typedef E expression_type;
+    typedef T value_type_1;
+    typedef S scalar_type;
+    typedef typename marray_detail::PromoteType<T, S>::type vector_value_type;
+    typedef typename marray_detail::BinaryResultType<BinaryFunctor, 
+        vector_value_type>::type value_type;
+    typedef BinaryFunctor functor_type;
+    typedef ViewExpression<BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>, 
+        value_type> base;
+
+    BinaryViewExpressionScalarFirst(const ViewExpression<E, T>& e, 
+        const scalar_type& scalar) 
+        : e_(e), // cast!
+          scalar_(scalar), binaryFunctor_(BinaryFunctor()) 
+        { }
+    const std::size_t dimension() const 
+        { return e_.dimension(); }
+    const std::size_t size() const 
+        { return e_.size(); }
+    const std::size_t shape(const std::size_t j) const 
+        { return e_.shape(j); }
+    const std::size_t* shapeBegin() const 
+        { return e_.shapeBegin(); }
+    const std::size_t* shapeEnd() const 
+        { return e_.shapeEnd(); }
+    template<class Tv, bool isConst, class A> 
+        bool overlaps(const View<Tv, isConst, A>& v) const
+            { return e_.overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return e_.overlapsOtherEntries(v); }
+    const CoordinateOrder& coordinateOrder() const 
+        { return e_.coordinateOrder(); }
+    const bool isSimple() const
+        { return e_.isSimple(); }
+    template<class Accessor>
+        const value_type operator()(Accessor it) const
+            { return binaryFunctor_(scalar_, e_(it)); }
+    const value_type operator()(const std::size_t c0, const std::size_t c1) const
+        { return binaryFunctor_(scalar_, e_(c0, c1)); }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
+        { return binaryFunctor_(scalar_, e_(c0, c1, c2)); }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
+        { return binaryFunctor_(scalar_, e_(c0, c1, c2, c3)); }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
+        { return binaryFunctor_(scalar_, e_(c0, c1, c2, c3, c4)); }
+    const value_type operator[](const std::size_t offset) const
+        { return binaryFunctor_(scalar_, e_[offset]); }
+    static const bool vectorizable = E::vectorizable 
+        && marray_detail::IsEqual<T, vector_value_type>::type
+        && marray_detail::IsEqual<typename E::vector_value_type, T>::type
+        && marray_detail::SimdExpressionFunctor<BinaryFunctor>::supported;
+    template<class V>
+        void vectorAt(const std::size_t offset, V& x) const
+            {   V y;
+                e_.vectorAt(offset, y); 
+                x = V() + static_cast<T>(scalar_);
+                marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
+
+    class ExpressionIterator {
+    public:
+        ExpressionIterator(const BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>& expression)
+        : binaryFunctor_(expression.binaryFunctor_),
+          scalar_(expression.scalar_),
+          iterator_(expression.e_)
+            {}
+        ExpressionIterator(const BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : binaryFunctor_(expression.binaryFunctor_),
+          scalar_(expression.scalar_),
+          iterator_(expression.e_, dimension, shape)
+            {}
+        void incrementCoordinate(const std::size_t coordinateIndex)
+            { iterator_.incrementCoordinate(coordinateIndex); }
+        void resetCoordinate(const std::size_t coordinateIndex)
+            { iterator_.resetCoordinate(coordinateIndex); }
+        void setRowDimension(const std::size_t rowDimension)
+            { iterator_.setRowDimension(rowDimension); }
+        const value_type operator*() const
             { return binaryFunctor_(scalar_, *iterator_); }
+        const value_type at(const std::size_t k) const
+            { return binaryFunctor_(scalar_, iterator_.at(k)); }
+        bool isContiguous() const
+            { return iterator_.isContiguous(); }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   V y;
+                    iterator_.vectorAt(k, y); 
+                    x = V() + static_cast<T>(scalar_);
+                    marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
     private:
         BinaryFunctor binaryFunctor_;
         const typename BinaryViewExpressionScalarFirst<E, T, S, BinaryFunctor>::scalar_type& scalar_;
@@ -4436,12 +6504,15 @@ private:
 template<class E, class T, class S, class BinaryFunctor>
 class BinaryViewExpressionScalarSecond
 : public ViewExpression<BinaryViewExpressionScalarSecond<E, T, S, BinaryFunctor>, 
-                        typename marray_detail::PromoteType<T, S>::type> {
+                        typename marray_detail::BinaryResultType<BinaryFunctor, 
+                            typename marray_detail::PromoteType<T, S>::type>::type> {
 public:
     typedef T value_type_1;
     typedef E expression_type;
     typedef S scalar_type;
-    typedef typename marray_detail::PromoteType<T, S>::type value_type;
+    typedef typename marray_detail::PromoteType<T, S>::type vector_value_type;
+    typedef typename marray_detail::BinaryResultType<BinaryFunctor, 
+        vector_value_type>::type value_type;
     typedef BinaryFunctor functor_type;
     typedef ViewExpression<BinaryViewExpressionScalarSecond<E, T, S, BinaryFunctor>, 
         value_type> base;
@@ -4464,6 +6535,9 @@ public:
     template<class Tv, bool isConst, class A> 
         bool overlaps(const View<Tv, isConst, A>& v) const
             { return e_.overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return e_.overlapsOtherEntries(v); }
     const CoordinateOrder& coordinateOrder() const 
         { return e_.coordinateOrder(); }
     const bool isSimple() const
@@ -4481,6 +6555,15 @@ public:
         { return binaryFunctor_(e_(c0, c1, c2, c3, c4), scalar_); }
     const value_type operator[](const std::size_t offset) const
         { return binaryFunctor_(e_[offset], scalar_); }
+    static const bool vectorizable = E::vectorizable 
+        && marray_detail::IsEqual<T, vector_value_type>::type
+        && marray_detail::IsEqual<typename E::vector_value_type, T>::type
+        && marray_detail::SimdExpressionFunctor<BinaryFunctor>::supported;
+    template<class V>
+        void vectorAt(const std::size_t offset, V& x) const
+            {   const V y = V() + static_cast<T>(scalar_);
+                e_.vectorAt(offset, x); 
+                marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
 
     class ExpressionIterator {
     public:
@@ -4489,12 +6572,29 @@ public:
           scalar_(expression.scalar_),
           iterator_(expression.e_)
             {}
+        ExpressionIterator(const BinaryViewExpressionScalarSecond<E, T, S, BinaryFunctor>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : binaryFunctor_(expression.binaryFunctor_),
+          scalar_(expression.scalar_),
+          iterator_(expression.e_, dimension, shape)
+            {}
         void incrementCoordinate(const std::size_t coordinateIndex)
             { iterator_.incrementCoordinate(coordinateIndex); }
         void resetCoordinate(const std::size_t coordinateIndex)
             { iterator_.resetCoordinate(coordinateIndex); }
-        const T operator*() const
+        void setRowDimension(const std::size_t rowDimension)
+            { iterator_.setRowDimension(rowDimension); }
+        const value_type operator*() const
             { return binaryFunctor_(*iterator_, scalar_); }
+        const value_type at(const std::size_t k) const
+            { return binaryFunctor_(iterator_.at(k), scalar_); }
+        bool isContiguous() const
+            { return iterator_.isContiguous(); }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   const V y = V() + static_cast<T>(scalar_);
+                    iterator_.vectorAt(k, x); 
+                    marray_detail::SimdExpressionFunctor<BinaryFunctor>::apply(x, y); }
     private:
         BinaryFunctor binaryFunctor_;
         const typename BinaryViewExpressionScalarSecond<E, T, S, BinaryFunctor>::scalar_type& scalar_;
@@ -4506,12 +6606,485 @@ private:
     const scalar_type scalar_;
     BinaryFunctor binaryFunctor_;
 };
-// \endcond suppress_doxygen
 
-// implementation of marray_detail 
+// a scalar as an expression of dimension 0 that is broadcast to the shape
+// of the other operands of a SelectViewExpression, cf. where()
+template<class T>
+class ConstantViewExpression
+: public ViewExpression<ConstantViewExpression<T>, T> {
+public:
+    typedef T value_type;
+    typedef T vector_value_type;
+    typedef ViewExpression<ConstantViewExpression<T>, T> base;
 
-// \cond suppress_doxygen
-namespace marray_detail { 
+    ConstantViewExpression(const T& value)
+        : value_(value), coordinateOrder_(defaultOrder)
+        { }
+    const std::size_t dimension() const 
+        { return 0; }
+    const std::size_t size() const 
+        { return 1; }
+    const std::size_t shape(const std::size_t) const 
+        { return 1; }
+    const std::size_t* shapeBegin() const 
+        { return 0; }
+    const std::size_t* shapeEnd() const 
+        { return 0; }
+    template<class Tv, bool isConst, class A> 
+        bool overlaps(const View<Tv, isConst, A>&) const
+            { return false; }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>&) const
+            { return false; }
+    const CoordinateOrder& coordinateOrder() const 
+        { return coordinateOrder_; }
+    const bool isSimple() const
+        { return true; }
+    template<class Accessor>
+        const value_type operator()(Accessor) const
+            { return value_; }
+    const value_type operator()(const std::size_t, const std::size_t) const
+        { return value_; }
+    const value_type operator()(const std::size_t, const std::size_t, const std::size_t) const 
+        { return value_; }
+    const value_type operator()(const std::size_t, const std::size_t, const std::size_t, const std::size_t) const 
+        { return value_; }
+    const value_type operator()(const std::size_t, const std::size_t, const std::size_t, const std::size_t, const std::size_t) const 
+        { return value_; }
+    const value_type operator[](const std::size_t) const
+        { return value_; }
+    static const bool vectorizable = marray_detail::TypeTraits<T>::position < 10;
+    template<class V>
+        void vectorAt(const std::size_t, V& x) const
+            { x = V() + value_; }
+
+    class ExpressionIterator {
+    public:
+        ExpressionIterator(const ConstantViewExpression<T>& expression)
+        : value_(expression.value_)
+            {}
+        ExpressionIterator(const ConstantViewExpression<T>& expression,
+            const std::size_t, const std::size_t*)
+        : value_(expression.value_)
+            {}
+        void incrementCoordinate(const std::size_t)
+            { }
+        void resetCoordinate(const std::size_t)
+            { }
+        void setRowDimension(const std::size_t)
+            { }
+        const value_type operator*() const
+            { return value_; }
+        const value_type at(const std::size_t) const
+            { return value_; }
+        bool isContiguous() const
+            { return true; }
+        template<class V>
+            void vectorAt(const std::size_t, V& x) const
+                { x = V() + value_; }
+    private:
+        value_type value_;
+    };
+
+private:
+    value_type value_;
+    CoordinateOrder coordinateOrder_;
+};
+
+// entries of e2 where the mask e1 is true and entries of e3 elsewhere. 
+// All operands are broadcast to a common shape, like the operands of a
+// BinaryViewExpression. ConstantViewExpressions are held by value. 
+//
+// If the mask is a comparison of vectors of the value type of the result,
+// the selection is evaluated without branches, by blending the vectors 
+// of e2 and e3 with the mask, cf. marray_detail::simdWhere().
+template<class E1, class T1, class E2, class T2, class E3, class T3>
+class SelectViewExpression
+: public ViewExpression<SelectViewExpression<E1, T1, E2, T2, E3, T3>, 
+                        typename marray_detail::PromoteType<T2, T3>::type>
+{
+public:
+    typedef E1 expression_type_1;
+    typedef E2 expression_type_2;
+    typedef E3 expression_type_3;
+    typedef typename marray_detail::PromoteType<T2, T3>::type value_type;
+    typedef value_type vector_value_type;
+    typedef ViewExpression<SelectViewExpression<E1, T1, E2, T2, E3, T3>, 
+        value_type> base;
+
+    SelectViewExpression(const ViewExpression<E1, T1>& e1, 
+        const ViewExpression<E2, T2>& e2, const ViewExpression<E3, T3>& e3) 
+        : e1_(e1), e2_(e2), e3_(e3), // cast!
+          broadcasting_(false),
+          shape_(),
+          size_(0)
+        {
+            if(!MARRAY_NO_DEBUG) {
+                marray_detail::Assert(e1_.size() != 0 && e2_.size() != 0 && e3_.size() != 0);
+            }
+            const std::size_t dimension = std::max(e1_.dimension(), 
+                std::max(e2_.dimension(), e3_.dimension()));
+            shape_.resize(dimension);
+            size_ = 1;
+            for(std::size_t j=0; j<dimension; ++j) {
+                shape_[j] = std::max(extent(e1_, dimension, j), 
+                    std::max(extent(e2_, dimension, j), extent(e3_, dimension, j)));
+                if(!MARRAY_NO_ARG_TEST) {
+                    marray_detail::Assert(conforms(e1_, dimension, j) 
+                        && conforms(e2_, dimension, j) && conforms(e3_, dimension, j));
+                }
+                size_ *= shape_[j];
+            }
+            broadcasting_ = !(matches(e1_) && matches(e2_) && matches(e3_));
+            if(!broadcasting_) {
+                shape_.clear();
+            }
+        }
+    const std::size_t dimension() const 
+        { return broadcasting_ ? shape_.size() : e1_.dimension(); }
+    const std::size_t size() const 
+        { return broadcasting_ ? size_ : e1_.size(); }
+    const std::size_t shape(const std::size_t j) const 
+        { return broadcasting_ ? shape_[j] : e1_.shape(j); }
+    const std::size_t* shapeBegin() const 
+        { return broadcasting_ ? shape_.data() : e1_.shapeBegin(); }
+    const std::size_t* shapeEnd() const 
+        { return broadcasting_ ? shape_.data() + shape_.size() : e1_.shapeEnd(); }
+    template<class Tv, bool isConst, class A> 
+        bool overlaps(const View<Tv, isConst, A>& v) const
+            { return e1_.overlaps(v) || e2_.overlaps(v) || e3_.overlaps(v); }
+    template<class Tv, bool isConst, class A> 
+        bool overlapsOtherEntries(const View<Tv, isConst, A>& v) const
+            { return e1_.overlapsOtherEntries(v) || e2_.overlapsOtherEntries(v) 
+                     || e3_.overlapsOtherEntries(v); }
+    const CoordinateOrder& coordinateOrder() const 
+        { return e1_.coordinateOrder(); }
+    const bool isSimple() const
+        { return !broadcasting_ && e1_.isSimple() && e2_.isSimple() && e3_.isSimple() 
+                 && (constant2 || e1_.coordinateOrder() == e2_.coordinateOrder())
+                 && (constant3 || e1_.coordinateOrder() == e3_.coordinateOrder()); }
+    template<class Accessor>
+        const value_type operator()(Accessor it) const
+            { 
+                if(broadcasting_) {
+                    return broadcastAccess(it, std::integral_constant<bool, 
+                        std::numeric_limits<Accessor>::is_integer>());
+                }
+                else {
+                    return select(e1_(it), e2_(it), e3_(it)); 
+                }
+            }
+    const value_type operator()(const std::size_t c0, const std::size_t c1) const
+        { 
+            const std::size_t c[] = {c0, c1};
+            return (*this)(&c[0]);
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2) const 
+        { 
+            const std::size_t c[] = {c0, c1, c2};
+            return (*this)(&c[0]);
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3) const 
+        { 
+            const std::size_t c[] = {c0, c1, c2, c3};
+            return (*this)(&c[0]);
+        }
+    const value_type operator()(const std::size_t c0, const std::size_t c1, const std::size_t c2, const std::size_t c3, const std::size_t c4) const 
+        { 
+            const std::size_t c[] = {c0, c1, c2, c3, c4};
+            return (*this)(&c[0]);
+        }
+    const value_type operator[](const std::size_t offset) const
+        { return select(e1_[offset], e2_[offset], e3_[offset]); }
+    static const bool vectorizable = E1::vectorizable && E2::vectorizable && E3::vectorizable
+        && marray_detail::IsEqual<T1, bool>::type
+        && marray_detail::IsEqual<typename E1::vector_value_type, value_type>::type
+        && marray_detail::IsEqual<T2, value_type>::type
+        && marray_detail::IsEqual<T3, value_type>::type
+        && marray_detail::IsEqual<typename E2::vector_value_type, value_type>::type
+        && marray_detail::IsEqual<typename E3::vector_value_type, value_type>::type
+        && marray_detail::TypeTraits<value_type>::position < 10;
+    template<class V>
+        void vectorAt(const std::size_t offset, V& x) const
+            {   typedef decltype(x < x) Mask;
+                V mask;
+                V y;
+                e1_.vectorAt(offset, mask);
+                e2_.vectorAt(offset, y);
+                e3_.vectorAt(offset, x);
+                marray_detail::simdWhere((Mask)mask, y, x); }
+
+    class ExpressionIterator {
+    public:
+        ExpressionIterator(const SelectViewExpression<E1, T1, E2, T2, E3, T3>& expression)
+        : iterator1_(expression.e1_, expression.dimension(), expression.shapeBegin()), 
+          iterator2_(expression.e2_, expression.dimension(), expression.shapeBegin()),
+          iterator3_(expression.e3_, expression.dimension(), expression.shapeBegin())
+            {}
+        ExpressionIterator(const SelectViewExpression<E1, T1, E2, T2, E3, T3>& expression,
+            const std::size_t dimension, const std::size_t* shape)
+        : iterator1_(expression.e1_, dimension, shape), 
+          iterator2_(expression.e2_, dimension, shape),
+          iterator3_(expression.e3_, dimension, shape)
+            {}
+        void incrementCoordinate(const std::size_t coordinateIndex)
+            {   iterator1_.incrementCoordinate(coordinateIndex); 
+                iterator2_.incrementCoordinate(coordinateIndex); 
+                iterator3_.incrementCoordinate(coordinateIndex); }
+        void resetCoordinate(const std::size_t coordinateIndex)
+            {   iterator1_.resetCoordinate(coordinateIndex); 
+                iterator2_.resetCoordinate(coordinateIndex); 
+                iterator3_.resetCoordinate(coordinateIndex); }
+        void setRowDimension(const std::size_t rowDimension)
+            {   iterator1_.setRowDimension(rowDimension); 
+                iterator2_.setRowDimension(rowDimension); 
+                iterator3_.setRowDimension(rowDimension); }
+        const value_type operator*() const
+            { return select(*iterator1_, *iterator2_, *iterator3_); }
+        const value_type at(const std::size_t k) const
+            { return select(iterator1_.at(k), iterator2_.at(k), iterator3_.at(k)); }
+        bool isContiguous() const
+            { return iterator1_.isContiguous() && iterator2_.isContiguous() 
+                     && iterator3_.isContiguous(); }
+        template<class V>
+            void vectorAt(const std::size_t k, V& x) const
+                {   typedef decltype(x < x) Mask;
+                    V mask;
+                    V y;
+                    iterator1_.vectorAt(k, mask);
+                    iterator2_.vectorAt(k, y);
+                    iterator3_.vectorAt(k, x);
+                    marray_detail::simdWhere((Mask)mask, y, x); }
+    private:
+        typename E1::ExpressionIterator iterator1_;
+        typename E2::ExpressionIterator iterator2_;
+        typename E3::ExpressionIterator iterator3_;
+    };
+
+private:
+    static const bool constant2 = marray_detail::IsConstantExpression<E2>::type;
+    static const bool constant3 = marray_detail::IsConstantExpression<E3>::type;
+
+    static value_type select(const T1& mask, const T2& x, const T3& y)
+        { return mask ? static_cast<value_type>(x) : static_cast<value_type>(y); }
+    // extent of dimension j of an operand aligned at the last of dimension
+    // dimensions. Operands of dimension 0 are broadcast to any shape.
+    template<class E>
+        static std::size_t extent(const E& e, const std::size_t dimension, const std::size_t j)
+            { return j < dimension - e.dimension() ? 1 : e.shape(j - (dimension - e.dimension())); }
+    template<class E>
+        bool conforms(const E& e, const std::size_t dimension, const std::size_t j) const
+            { return extent(e, dimension, j) == 1 || extent(e, dimension, j) == shape_[j]; }
+    template<class E>
+        bool matches(const E& e) const
+            { 
+                if(marray_detail::IsConstantExpression<E>::type) {
+                    return true;
+                }
+                return e.dimension() == shape_.size() 
+                    && std::equal(shape_.begin(), shape_.end(), e.shapeBegin());
+            }
+    template<class CoordinateIterator>
+        const value_type broadcastAccess(CoordinateIterator it, std::false_type) const
+            {
+                typedef marray_detail::BroadcastCoordinateIterator<CoordinateIterator> Iterator;
+                return select(
+                    e1_(Iterator(it, shape_.size() - e1_.dimension(), e1_.shapeBegin(), e1_.dimension())), 
+                    e2_(Iterator(it, shape_.size() - e2_.dimension(), e2_.shapeBegin(), e2_.dimension())), 
+                    e3_(Iterator(it, shape_.size() - e3_.dimension(), e3_.shapeBegin(), e3_.dimension())));
+            }
+    template<class Index>
+        const value_type broadcastAccess(Index index, std::true_type) const
+            {
+                std::vector<std::size_t> c(shape_.size());
+                std::size_t r = static_cast<std::size_t>(index);
+                for(std::size_t k=0; k<shape_.size(); ++k) {
+                    const std::size_t j = (coordinateOrder() == FirstMajorOrder ? shape_.size() - 1 - k : k);
+                    c[j] = r % shape_[j];
+                    r /= shape_[j];
+                }
+                return broadcastAccess(c.begin(), std::false_type());
+            }
+
+    const E1& e1_;
+    typename marray_detail::IfBool<constant2, const E2, const E2&>::type e2_;
+    typename marray_detail::IfBool<constant3, const E3, const E3&>::type e3_;
+    bool broadcasting_;
+    std::vector<std::size_t> shape_;
+    std::size_t size_;
+};
+// \endcond suppress_doxygen
+
+// implementation of marray_detail 
+
+// \cond suppress_doxygen
+namespace marray_detail { 
+
+template<class T, std::size_t N>
+inline
+SmallVector<T, N>::SmallVector
+(
+    const std::size_t size
+)
+:   data_(size <= N ? buffer_ : new T[size]),
+    size_(size)
+{
+    std::fill(data_, data_ + size_, T());
+}
+
+template<class T, std::size_t N>
+template<class Iterator>
+inline
+SmallVector<T, N>::SmallVector
+(
+    Iterator begin,
+    Iterator end
+)
+:   data_(0),
+    size_(static_cast<std::size_t>(std::distance(begin, end)))
+{
+    data_ = size_ <= N ? buffer_ : new T[size_];
+    std::copy(begin, end, data_);
+}
+
+template<class T, std::size_t N>
+inline
+SmallVector<T, N>::SmallVector
+(
+    const SmallVector<T, N>& in
+)
+:   data_(in.size_ <= N ? buffer_ : new T[in.size_]),
+    size_(in.size_)
+{
+    std::copy(in.data_, in.data_ + size_, data_);
+}
+
+template<class T, std::size_t N>
+inline
+SmallVector<T, N>::SmallVector
+(
+    SmallVector<T, N>&& in
+) noexcept
+:   data_(in.size_ <= N ? buffer_ : in.data_),
+    size_(in.size_)
+{
+    if(size_ <= N) {
+        std::copy(in.data_, in.data_ + size_, data_);
+    }
+    in.data_ = in.buffer_;
+    in.size_ = 0;
+}
+
+template<class T, std::size_t N>
+inline
+SmallVector<T, N>::~SmallVector()
+{
+    if(size_ > N) {
+        delete[] data_;
+    }
+}
+
+template<class T, std::size_t N>
+inline SmallVector<T, N>&
+SmallVector<T, N>::operator=
+(
+    const SmallVector<T, N>& in
+)
+{
+    if(&in != this) { // no self-assignment
+        if(in.size_ != size_) {
+            if(size_ > N) {
+                delete[] data_;
+            }
+            data_ = (in.size_ <= N ? buffer_ : new T[in.size_]);
+            size_ = in.size_;
+        }
+        std::copy(in.data_, in.data_ + size_, data_);
+    }
+    return *this;
+}
+
+template<class T, std::size_t N>
+inline SmallVector<T, N>&
+SmallVector<T, N>::operator=
+(
+    SmallVector<T, N>&& in
+) noexcept
+{
+    if(&in != this) { // no self-assignment
+        if(size_ > N) {
+            delete[] data_;
+        }
+        size_ = in.size_;
+        if(size_ <= N) {
+            data_ = buffer_;
+            std::copy(in.data_, in.data_ + size_, data_);
+        }
+        else {
+            data_ = in.data_;
+        }
+        in.data_ = in.buffer_;
+        in.size_ = 0;
+    }
+    return *this;
+}
+
+template<class T, std::size_t N>
+inline const std::size_t
+SmallVector<T, N>::size() const
+{
+    return size_;
+}
+
+template<class T, std::size_t N>
+inline const T&
+SmallVector<T, N>::operator[]
+(
+    const std::size_t j
+) const
+{
+    Assert(MARRAY_NO_DEBUG || j < size_);
+    return data_[j];
+}
+
+template<class T, std::size_t N>
+inline T&
+SmallVector<T, N>::operator[]
+(
+    const std::size_t j
+)
+{
+    Assert(MARRAY_NO_DEBUG || j < size_);
+    return data_[j];
+}
+
+template<class T, std::size_t N>
+inline const T*
+SmallVector<T, N>::begin() const
+{
+    return data_;
+}
+
+template<class T, std::size_t N>
+inline T*
+SmallVector<T, N>::begin()
+{
+    return data_;
+}
+
+template<class T, std::size_t N>
+inline const T*
+SmallVector<T, N>::end() const
+{
+    return data_ + size_;
+}
+
+template<class T, std::size_t N>
+inline T*
+SmallVector<T, N>::end()
+{
+    return data_ + size_;
+}
 
 template<class A>
 class Geometry 
@@ -4533,9 +7106,12 @@ public:
             const CoordinateOrder& = defaultOrder, 
             const allocator_type& = allocator_type());
     Geometry(const Geometry<A>&);
+    Geometry(Geometry<A>&&) noexcept;
     ~Geometry();
 
     Geometry<A>& operator=(const Geometry<A>&);
+    Geometry<A>& operator=(Geometry<A>&&) noexcept;
+    void swap(Geometry<A>&) noexcept;
 
     void resize(const std::size_t dimension);
     const std::size_t dimension() const;
@@ -4565,998 +7141,5787 @@ public:
     void updateSimplicity();
     bool& isSimple();
 
-private:
-    allocator_type allocator_;  
-    std::size_t* shape_;
-    std::size_t* shapeStrides_;
-        // Intended redundancy: shapeStrides_ could be
-        // computed from shape_ and coordinateOrder_
-    std::size_t* strides_;
-    std::size_t dimension_;
-    std::size_t size_;
-        // intended redundancy: size_ could be computed from shape_
-    CoordinateOrder coordinateOrder_;
-    bool isSimple_; 
-        // simple array: an array which is unstrided (i.e. the strides
-        // equal the shape strides), cf. the function testInvariant of 
-        // View for the formal definition.
-};
+private:
+    void allocate(const std::size_t);
+    void deallocate();
+    void copyFrom(const Geometry<A>&);
+    void moveFrom(Geometry<A>&);
+
+    allocator_type allocator_;  
+    std::size_t* shape_;
+    std::size_t* shapeStrides_;
+        // Intended redundancy: shapeStrides_ could be
+        // computed from shape_ and coordinateOrder_
+    std::size_t* strides_;
+    std::size_t dimension_;
+    std::size_t size_;
+        // intended redundancy: size_ could be computed from shape_
+    CoordinateOrder coordinateOrder_;
+    bool isSimple_; 
+        // simple array: an array which is unstrided (i.e. the strides
+        // equal the shape strides), cf. the function testInvariant of 
+        // View for the formal definition.
+    std::size_t buffer_[3 * MARRAY_INLINE_DIMENSION];
+        // shape_, shapeStrides_ and strides_ point into buffer_ at
+        // the fixed offsets 0, MARRAY_INLINE_DIMENSION and 
+        // 2*MARRAY_INLINE_DIMENSION unless the dimension exceeds
+        // MARRAY_INLINE_DIMENSION, such that views of small dimension
+        // are created without dynamic memory allocation.
+};
+
+template<class A>
+inline 
+Geometry<A>::Geometry
+(
+    const typename Geometry<A>::allocator_type& allocator
+) 
+: allocator_(allocator),
+  dimension_(0),
+  size_(0), 
+  coordinateOrder_(defaultOrder), 
+  isSimple_(true)
+{
+    allocate(0);
+}
+
+template<class A>
+inline 
+Geometry<A>::Geometry
+(
+    const Geometry<A>& g
+)
+: allocator_(g.allocator_),
+  dimension_(g.dimension_),
+  size_(g.size_), 
+  coordinateOrder_(g.coordinateOrder_), 
+  isSimple_(g.isSimple_)
+{
+    allocate(dimension_);
+    copyFrom(g);
+}
+
+// takes over the memory of g (if g stores its entries on the heap) and
+// leaves g without dimensions
+template<class A>
+inline 
+Geometry<A>::Geometry
+(
+    Geometry<A>&& g
+) noexcept
+: allocator_(g.allocator_),
+  dimension_(g.dimension_),
+  size_(g.size_), 
+  coordinateOrder_(g.coordinateOrder_), 
+  isSimple_(g.isSimple_)
+{
+    moveFrom(g);
+}
+
+template<class A>
+inline 
+Geometry<A>::Geometry
+(
+    const std::size_t dimension,
+    const CoordinateOrder& order,
+    const std::size_t size,
+    const bool isSimple,
+    const typename Geometry<A>::allocator_type& allocator
+)
+: allocator_(allocator),
+  dimension_(dimension),
+  size_(size),
+  coordinateOrder_(order),
+  isSimple_(isSimple)
+{
+    allocate(dimension_);
+}
+
+template<class A>
+template<class ShapeIterator>
+inline 
+Geometry<A>::Geometry
+(
+    ShapeIterator begin, 
+    ShapeIterator end,
+    const CoordinateOrder& externalCoordinateOrder,
+    const CoordinateOrder& internalCoordinateOrder,
+    const typename Geometry<A>::allocator_type& allocator
+)
+: allocator_(allocator),
+  dimension_(std::distance(begin, end)),
+  size_(1),
+  coordinateOrder_(internalCoordinateOrder),
+  isSimple_(true)
+{
+    allocate(dimension_);
+    if(dimension_ != 0) { // if the array is not a scalar
+        isSimple_ = (externalCoordinateOrder == internalCoordinateOrder);
+        for(std::size_t j=0; j<dimension(); ++j, ++begin) {
+            const std::size_t s = static_cast<std::size_t>(*begin);
+            shape(j) = s;
+            size() *= s;
+        }
+        stridesFromShape(shapeBegin(), shapeEnd(), stridesBegin(), 
+            externalCoordinateOrder);
+        stridesFromShape(shapeBegin(), shapeEnd(), shapeStridesBegin(), 
+            internalCoordinateOrder);
+    }
+}
+
+template<class A>
+template<class ShapeIterator, class StrideIterator>
+inline
+Geometry<A>::Geometry
+(
+    ShapeIterator begin, 
+    ShapeIterator end,
+    StrideIterator it,
+    const CoordinateOrder& internalCoordinateOrder,
+    const typename Geometry<A>::allocator_type& allocator
+)
+: allocator_(allocator),
+  dimension_(std::distance(begin, end)),
+  size_(1),
+  coordinateOrder_(internalCoordinateOrder),
+  isSimple_(true)
+{
+    allocate(dimension_);
+    if(dimension() != 0) {
+        for(std::size_t j=0; j<dimension(); ++j, ++begin, ++it) {
+            const std::size_t s = static_cast<std::size_t>(*begin);
+            shape(j) = s;
+            size() *= s;
+            strides(j) = *it;
+        }
+        stridesFromShape(shapeBegin(), shapeEnd(), shapeStridesBegin(), 
+            internalCoordinateOrder);
+        updateSimplicity();
+    }
+}
+
+template<class A>
+inline 
+Geometry<A>::~Geometry()
+{
+    deallocate();
+}
+
+template<class A>
+inline Geometry<A>& 
+Geometry<A>::operator=
+(
+    const Geometry<A>& g
+)
+{
+    if(&g != this) { // no self-assignment
+        resize(g.dimension_);
+        copyFrom(g);
+        size_ = g.size_;
+        coordinateOrder_ = g.coordinateOrder_;
+        isSimple_ = g.isSimple_;
+    }
+    return *this;
+}
+
+// takes over the memory of g (if g stores its entries on the heap) and
+// leaves g without dimensions
+template<class A>
+inline Geometry<A>& 
+Geometry<A>::operator=
+(
+    Geometry<A>&& g
+) noexcept
+{
+    if(&g != this) { // no self-assignment
+        deallocate();
+        allocator_ = g.allocator_;
+        dimension_ = g.dimension_;
+        size_ = g.size_;
+        coordinateOrder_ = g.coordinateOrder_;
+        isSimple_ = g.isSimple_;
+        moveFrom(g);
+    }
+    return *this;
+}
+
+template<class A>
+inline void
+Geometry<A>::swap
+(
+    Geometry<A>& g
+) noexcept
+{
+    Geometry<A> tmp(std::move(g));
+    g = std::move(*this);
+    *this = std::move(tmp);
+}
+
+template<class A>
+inline void 
+Geometry<A>::resize
+(
+    const std::size_t dimension
+)
+{
+    if(dimension != dimension_) {
+        if(dimension <= MARRAY_INLINE_DIMENSION && dimension_ <= MARRAY_INLINE_DIMENSION) {
+            // existing entries remain in place
+            dimension_ = dimension;
+        }
+        else {
+            std::size_t* shape = shape_;
+            std::size_t* shapeStrides = shapeStrides_;
+            std::size_t* strides = strides_;
+            const std::size_t n = (dimension < dimension_) ? dimension : dimension_;
+            const bool onHeap = dimension_ > MARRAY_INLINE_DIMENSION;
+            const std::size_t oldDimension = dimension_;
+            allocate(dimension);
+            // save existing entries
+            memmove(shape_, shape, n * sizeof(std::size_t));
+            memmove(shapeStrides_, shapeStrides, n * sizeof(std::size_t));
+            memmove(strides_, strides, n * sizeof(std::size_t));
+            if(onHeap) {
+                allocator_.deallocate(shape, oldDimension*3);
+            }
+            dimension_ = dimension;
+        }
+    }
+}
+
+// let shape_, shapeStrides_ and strides_ point to memory for the 
+// given dimension (dimension_ is not changed)
+template<class A>
+inline void
+Geometry<A>::allocate
+(
+    const std::size_t dimension
+)
+{
+    if(dimension <= MARRAY_INLINE_DIMENSION) {
+        shape_ = buffer_;
+        shapeStrides_ = buffer_ + MARRAY_INLINE_DIMENSION;
+        strides_ = buffer_ + 2 * MARRAY_INLINE_DIMENSION;
+    }
+    else {
+        shape_ = allocator_.allocate(dimension*3);
+        shapeStrides_ = shape_ + dimension;
+        strides_ = shapeStrides_ + dimension;
+    }
+}
+
+template<class A>
+inline void
+Geometry<A>::deallocate()
+{
+    if(dimension_ > MARRAY_INLINE_DIMENSION) {
+        allocator_.deallocate(shape_, dimension_*3);
+    }
+}
+
+// copies shape, shape strides and strides from g of the same dimension
+template<class A>
+inline void
+Geometry<A>::copyFrom
+(
+    const Geometry<A>& g
+)
+{
+    if(dimension_ > MARRAY_INLINE_DIMENSION) {
+        memcpy(shape_, g.shape_, (dimension_*3)*sizeof(std::size_t));
+    }
+    else {
+        memcpy(shape_, g.shape_, dimension_*sizeof(std::size_t));
+        memcpy(shapeStrides_, g.shapeStrides_, dimension_*sizeof(std::size_t));
+        memcpy(strides_, g.strides_, dimension_*sizeof(std::size_t));
+    }
+}
+
+// takes over the entries of g of the same dimension and leaves g 
+// without dimensions
+template<class A>
+inline void
+Geometry<A>::moveFrom
+(
+    Geometry<A>& g
+)
+{
+    if(dimension_ > MARRAY_INLINE_DIMENSION) {
+        shape_ = g.shape_;
+        shapeStrides_ = g.shapeStrides_;
+        strides_ = g.strides_;
+    }
+    else {
+        allocate(dimension_);
+        copyFrom(g);
+    }
+    g.allocate(0);
+    g.dimension_ = 0;
+    g.size_ = 0;
+    g.isSimple_ = true;
+}
+
+template<class A>
+inline const std::size_t 
+Geometry<A>::dimension() const
+{
+    return dimension_; 
+}
+
+template<class A>
+inline const std::size_t 
+Geometry<A>::shape(const std::size_t j) const
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return shape_[j]; 
+}
+
+template<class A>
+inline std::size_t& 
+Geometry<A>::shape(const std::size_t j)
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return shape_[j]; 
+}
+
+template<class A>
+inline const std::size_t 
+Geometry<A>::shapeStrides
+(
+    const std::size_t j
+) const
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return shapeStrides_[j]; 
+}
+
+template<class A>
+inline std::size_t& 
+Geometry<A>::shapeStrides
+(
+    const std::size_t j
+)
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return shapeStrides_[j]; 
+}
+
+template<class A>
+inline const std::size_t 
+Geometry<A>::strides
+(
+    const std::size_t j
+) const
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return strides_[j]; 
+}
+
+template<class A>
+inline std::size_t& 
+Geometry<A>::strides
+(
+    const std::size_t j
+)
+{ 
+    Assert(MARRAY_NO_DEBUG || j<dimension_); 
+    return strides_[j]; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::shapeBegin() const
+{ 
+    return shape_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::shapeBegin()
+{ 
+    return shape_; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::shapeEnd() const 
+{ 
+    return shape_ + dimension_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::shapeEnd() 
+{ 
+    return shape_ + dimension_; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::shapeStridesBegin() const 
+{ 
+    return shapeStrides_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::shapeStridesBegin() 
+{ 
+    return shapeStrides_; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::shapeStridesEnd() const 
+{ 
+    return shapeStrides_ + dimension_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::shapeStridesEnd() 
+{ 
+    return shapeStrides_ + dimension_; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::stridesBegin() const 
+{ 
+    return strides_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::stridesBegin() 
+{ 
+    return strides_; 
+}
+
+template<class A>
+inline const std::size_t* 
+Geometry<A>::stridesEnd() const 
+{ 
+    return strides_ + dimension_; 
+}
+
+template<class A>
+inline std::size_t* 
+Geometry<A>::stridesEnd() 
+{ 
+    return strides_ + dimension_; 
+}
+
+template<class A>
+inline const std::size_t 
+Geometry<A>::size() const
+{ 
+    return size_; 
+}
+
+template<class A>
+inline std::size_t& 
+Geometry<A>::size()
+{ 
+    return size_; 
+}
+
+template<class A>
+inline const CoordinateOrder& 
+Geometry<A>::coordinateOrder() const
+{ 
+    return coordinateOrder_; 
+}
+
+template<class A>
+inline CoordinateOrder& 
+Geometry<A>::coordinateOrder()
+{ 
+    return coordinateOrder_; 
+}
+
+template<class A>
+inline const bool 
+Geometry<A>::isSimple() const 
+{ 
+    return isSimple_; 
+}
+
+template<class A>
+inline bool& 
+Geometry<A>::isSimple()
+{ 
+    return isSimple_; 
+}
+
+template<class A>
+inline void
+Geometry<A>::updateSimplicity()
+{ 
+    for(std::size_t j=0; j<dimension(); ++j) {
+        if(shapeStrides(j) != strides(j)) {
+            isSimple_ = false;
+            return;
+        }
+    }
+    isSimple_ = true; 
+    // a 0-dimensional geometry is simple
+}
+
+template<class ShapeIterator, class StridesIterator>
+inline void 
+stridesFromShape
+(
+    ShapeIterator begin,
+    ShapeIterator end,
+    StridesIterator strideBegin,
+    const CoordinateOrder& coordinateOrder
+) 
+{
+    Assert(MARRAY_NO_ARG_TEST || std::distance(begin, end) != 0);
+    std::size_t dimension = std::distance(begin, end);
+    ShapeIterator shapeIt;
+    StridesIterator strideIt;
+    if(coordinateOrder == FirstMajorOrder) {
+        shapeIt = begin + (dimension-1);
+        strideIt = strideBegin + (dimension-1);
+        *strideIt = 1;
+        for(std::size_t j=1; j<dimension; ++j) {
+            std::size_t tmp = *strideIt;
+            --strideIt;
+            (*strideIt) = tmp * (*shapeIt);
+            --shapeIt;
+        }
+    }
+    else {
+        shapeIt = begin;
+        strideIt = strideBegin;
+        *strideIt = 1;
+        for(std::size_t j=1; j<dimension; ++j) {
+            std::size_t tmp = *strideIt;
+            ++strideIt;
+            (*strideIt) = tmp * (*shapeIt);
+            ++shapeIt;
+        }
+    }
+}
+
+// offset of an entry of a FixedRankView, the sum c[0]*strides[0] + ... 
+// + c[N-1]*strides[N-1] unrolled at compile time
+inline std::size_t
+fixedRankOffset
+(
+    const std::size_t* strides
+)
+{
+    return 0;
+}
+
+template<class... Args>
+inline std::size_t
+fixedRankOffset
+(
+    const std::size_t* strides,
+    const std::size_t c,
+    const Args... rest
+)
+{
+    return c * strides[0] + fixedRankOffset(strides + 1, rest...);
+}
+
+template<class TFrom, class TTo, class AFrom, class ATo> 
+struct AssignmentOperatorHelper<false, TFrom, TTo, AFrom, ATo>
+{
+    // from constant to mutable 
+    //
+    // here, 'to' must be initialized (which is asserted) because
+    // otherwise, the pointer to.data_ to mutable data would have 
+    // to be initialized with the pointer from.data_ to constant 
+    // data which we don't do.
+    //
+    static void execute
+    (
+        const View<TFrom, true, AFrom>& from,
+        View<TTo, false, ATo>& to
+    )
+    {
+        if(!MARRAY_NO_ARG_TEST) {
+            Assert(from.data_ != 0 && from.dimension() == to.dimension());
+            for(std::size_t j=0; j<from.dimension(); ++j) {
+                Assert(from.shape(j) == to.shape(j));
+            }
+        }
+        if(from.coordinateOrder() == to.coordinateOrder() 
+                && from.isSimple() && to.isSimple()
+                && IsEqual<TFrom, TTo>::type) {
+            if(from.overlaps(to)) {
+                memmove(to.data_, from.data_, from.size() * sizeof(TFrom));
+            }
+            else {
+                copyContiguous(to.data_, from.data_, from.size(), sizeof(TFrom));
+            }
+        }
+        else {
+            operate(to, from, Assign<TTo, TFrom>()); // handles overlap
+        }
+    }
+
+    /// from mutable to mutable.
+    ///
+    /// here, 'to' need not be initialized.
+    ///
+    static void execute
+    (
+        const View<TFrom, false, AFrom>& from,
+        View<TTo, false, ATo>& to
+    )
+    {
+        if(static_cast<const void*>(&from) != static_cast<const void*>(&to)) { // no self-assignment
+            if(to.data_ == 0) { // if the view 'to' is not initialized
+                // initialize the view 'to' with source data
+                Assert(MARRAY_NO_ARG_TEST || sizeof(TTo) == sizeof(TFrom));
+                to.data_ = static_cast<TTo*>(static_cast<void*>(from.data_)); // copy pointer
+                to.geometry_ = from.geometry_;
+            }
+            else { // if the view 'to' is initialized
+                if(!MARRAY_NO_ARG_TEST) {
+                    Assert(from.data_ != 0 && from.dimension() == to.dimension());
+                    for(std::size_t j=0; j<from.dimension(); ++j) {
+                        Assert(from.shape(j) == to.shape(j));
+                    }
+                }
+                if(from.coordinateOrder() == to.coordinateOrder() 
+                        && from.isSimple() && to.isSimple()
+                        && IsEqual<TFrom, TTo>::type) {
+                    if(from.overlaps(to)) {
+                        memmove(to.data_, from.data_, from.size() * sizeof(TFrom));
+                    }
+                    else {
+                        copyContiguous(to.data_, from.data_, from.size(), sizeof(TFrom));
+                    }
+                }
+                else {
+                    operate(to, from, Assign<TTo, TFrom>()); // handles overlap
+                }
+            }
+        }
+    }
+};
+
+template<class TFrom, class TTo, class AFrom, class ATo> 
+struct AssignmentOperatorHelper<true, TFrom, TTo, AFrom, ATo>
+{
+    /// from either constant or mutable to constant
+    template<bool isConstFrom>
+    static void execute
+    (
+        const View<TFrom, isConstFrom, AFrom>& from,
+        View<TTo, true, ATo>& to
+    )
+    {
+        Assert(MARRAY_NO_ARG_TEST || sizeof(TFrom) == sizeof(TTo));
+        to.data_ = static_cast<const TTo*>(
+            static_cast<const void*>(from.data_)); // copy pointer
+        to.geometry_ = from.geometry_;
+    }
+};
+
+template<>
+struct AccessOperatorHelper<true>
+{
+    // access by scalar index
+    template<class T, class U, bool isConst, class A>
+    static typename View<T, isConst, A>::reference
+    execute(const View<T, isConst, A>& v, const U& index)
+    {
+        v.testInvariant();
+        Assert(MARRAY_NO_DEBUG || v.data_ != 0);
+        Assert(MARRAY_NO_DEBUG || v.dimension() != 0 || index == 0);
+        std::size_t offset;
+        v.indexToOffset(index, offset);
+        return v.data_[offset];
+    }
+};
+
+template<>
+struct AccessOperatorHelper<false>
+{
+    // access by iterator
+    template<class T, class U, bool isConst, class A>
+    static typename View<T, isConst, A>::reference
+    execute(const View<T, isConst, A>& v, U it)
+    {
+        v.testInvariant();
+        Assert(MARRAY_NO_DEBUG || v.data_ != 0);
+        Assert(MARRAY_NO_DEBUG || v.dimension() != 0 || *it == 0);
+        std::size_t offset;
+        v.coordinatesToOffset(it, offset);
+        return v.data_[offset];
+    }
+};
+
+// Iterator over the coordinates of an operand of a broadcasting expression,
+// given an iterator over the coordinates of the expression: The first skip
+// coordinates are skipped, and the coordinates of singleton dimensions of
+// the operand are 0.
+template<class Iterator>
+class BroadcastCoordinateIterator
+{
+public:
+    BroadcastCoordinateIterator(Iterator it, const std::size_t skip, const std::size_t* shape, 
+        const std::size_t dimension)
+        : it_(it), shape_(shape), j_(0), dimension_(dimension)
+        {
+            for(std::size_t k=0; k<skip; ++k) {
+                ++it_;
+            }
+        }
+    std::size_t operator*() const
+        { return (j_ >= dimension_ || shape_[j_] == 1) ? 0 : static_cast<std::size_t>(*it_); }
+    BroadcastCoordinateIterator& operator++()
+        { ++it_; ++j_; return *this; }
+
+private:
+    Iterator it_;
+    const std::size_t* shape_;
+    std::size_t j_;
+    std::size_t dimension_;
+};
+
+// parallel execution
+
+struct ParallelSettings
+{
+    ParallelSettings()
+    :   numberOfThreads(1),
+        threshold(1 << 18)
+        {}
+
+    std::atomic<std::size_t> numberOfThreads;
+    std::atomic<std::size_t> threshold;
+};
+
+inline ParallelSettings& 
+parallelSettings()
+{
+    static ParallelSettings settings;
+    return settings;
+}
+
+// true for the worker threads of the ThreadPool and for a thread that
+// currently executes a parallel operation. Operations called from within
+// such a thread are executed serially.
+inline bool& 
+isInParallelRegion()
+{
+    static thread_local bool inParallelRegion = false;
+    return inParallelRegion;
+}
+
+// Pool of worker threads that execute the tasks of one parallel operation 
+// at a time. The thread that calls execute() takes part in the work. If the
+// pool is busy with an operation started from another thread, execute() 
+// returns false and the caller falls back to serial execution.
+class ThreadPool
+{
+public:
+    static ThreadPool& instance();
+
+    ThreadPool();
+    ~ThreadPool();
+
+    template<class Task>
+        bool execute(const std::size_t, const std::size_t, Task&);
+
+private:
+    ThreadPool(const ThreadPool&); // non-copyable
+    ThreadPool& operator=(const ThreadPool&); // non-copyable
+
+    void work(const std::size_t);
+    void workerLoop(const std::size_t);
+
+    std::mutex executionMutex_;
+    std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::condition_variable workDone_;
+    std::vector<std::thread> workers_;
+    const std::function<void(const std::size_t)>* task_;
+    std::size_t numberOfTasks_;
+    std::size_t numberOfThreads_;
+    std::atomic<std::size_t> nextTask_;
+    std::atomic<std::size_t> numberOfFinishedTasks_;
+    std::size_t numberOfActiveWorkers_;
+    std::size_t numberOfWorkingThreads_;
+    std::size_t generation_;
+    std::exception_ptr exception_;
+    bool stop_;
+};
+
+inline ThreadPool&
+ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+inline
+ThreadPool::ThreadPool()
+:   task_(0),
+    numberOfTasks_(0),
+    numberOfThreads_(0),
+    nextTask_(0),
+    numberOfFinishedTasks_(0),
+    numberOfActiveWorkers_(0),
+    numberOfWorkingThreads_(0),
+    generation_(0),
+    exception_(),
+    stop_(false)
+{}
+
+inline
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    workAvailable_.notify_all();
+    for(std::size_t j=0; j<workers_.size(); ++j) {
+        workers_[j].join();
+    }
+}
+
+// execute task(0), ..., task(numberOfTasks-1) using (at most) 
+// numberOfThreads threads, including the calling thread. 
+template<class Task>
+inline bool
+ThreadPool::execute
+(
+    const std::size_t numberOfThreads,
+    const std::size_t numberOfTasks,
+    Task& task
+)
+{
+    if(isInParallelRegion()) {
+        return false;
+    }
+    std::unique_lock<std::mutex> executionLock(executionMutex_, std::try_to_lock);
+    if(!executionLock.owns_lock()) {
+        return false;
+    }
+    const std::function<void(const std::size_t)> f(std::ref(task));
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        workDone_.wait(lock, [this] { return numberOfWorkingThreads_ == 0; });
+        while(workers_.size() + 1 < numberOfThreads) {
+            workers_.push_back(std::thread(&ThreadPool::workerLoop, this, workers_.size()));
+        }
+        task_ = &f;
+        numberOfTasks_ = numberOfTasks;
+        numberOfThreads_ = numberOfThreads;
+        nextTask_ = 0;
+        numberOfFinishedTasks_ = 0;
+        numberOfActiveWorkers_ = numberOfThreads - 1;
+        exception_ = std::exception_ptr();
+        ++generation_;
+    }
+    workAvailable_.notify_all();
+    isInParallelRegion() = true;
+    work(0);
+    isInParallelRegion() = false;
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        workDone_.wait(lock, [this] { 
+            return numberOfWorkingThreads_ == 0 
+                && numberOfFinishedTasks_ == numberOfTasks_; 
+        });
+        task_ = 0;
+        exception = exception_;
+    }
+    if(exception) {
+        std::rethrow_exception(exception);
+    }
+    return true;
+}
+
+// If there are as many tasks as threads, the calling thread (0) and the 
+// workers (1, 2, ...) execute the task of their own index. The j-th chunk
+// of every parallel operation, cf. numberOfChunks(), is thus processed by
+// the same thread, and memory first touched by that thread (in the 
+// initialization of an Marray) is local to its NUMA node. Otherwise, 
+// tasks are assigned to threads dynamically.
+inline void
+ThreadPool::work
+(
+    const std::size_t thread
+)
+{
+    const bool staticSchedule = numberOfTasks_ == numberOfThreads_;
+    for(std::size_t k=0; ; ++k) {
+        const std::size_t j = staticSchedule 
+            ? (k == 0 ? thread : numberOfTasks_)
+            : nextTask_++;
+        if(j >= numberOfTasks_) {
+            return;
+        }
+        try {
+            (*task_)(j);
+        }
+        catch(...) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if(!exception_) {
+                exception_ = std::current_exception();
+            }
+        }
+        ++numberOfFinishedTasks_;
+    }
+}
+
+inline void
+ThreadPool::workerLoop
+(
+    const std::size_t id
+)
+{
+    isInParallelRegion() = true;
+    std::size_t generation = 0;
+    for(;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            workAvailable_.wait(lock, [&] { return stop_ || generation_ != generation; });
+            if(stop_) {
+                return;
+            }
+            generation = generation_;
+            if(id >= numberOfActiveWorkers_) {
+                continue;
+            }
+            ++numberOfWorkingThreads_;
+        }
+        work(id + 1);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            --numberOfWorkingThreads_;
+        }
+        workDone_.notify_all();
+    }
+}
+
+// number of chunks into which an operation on size entries is partitioned
+inline std::size_t
+numberOfChunks
+(
+    const std::size_t size
+)
+{
+    const std::size_t n = parallelSettings().numberOfThreads;
+    if(n < 2 || size < n || size < parallelSettings().threshold 
+    || isInParallelRegion()) {
+        return 1;
+    }
+    return n;
+}
+
+// execute task(0), ..., task(numberOfTasks-1), in parallel if possible
+template<class Task>
+inline void
+parallelFor
+(
+    const std::size_t numberOfTasks,
+    Task task
+)
+{
+    if(numberOfTasks < 2 
+    || !ThreadPool::instance().execute(numberOfTasks, numberOfTasks, task)) {
+        for(std::size_t j=0; j<numberOfTasks; ++j) {
+            task(j);
+        }
+    }
+}
+
+// Partition of a View into chunks that can be processed independently.
+//
+// A simple View is partitioned into contiguous intervals of memory
+// (flat partition). Otherwise, the View is partitioned along the dimension
+// with the largest stride such that every chunk covers a compact region of
+// memory. Views of the same shape are partitioned consistently.
+class ViewPartition
+{
+public:
+    template<class T, bool isConst, class A>
+        ViewPartition(const View<T, isConst, A>&, const std::size_t, const bool);
+    std::size_t size() const
+        { return numberOfChunks_; }
+    std::size_t begin(const std::size_t j) const
+        { return (extent_ * j) / numberOfChunks_; }
+    std::size_t end(const std::size_t j) const
+        { return (extent_ * (j+1)) / numberOfChunks_; }
+    template<class T, bool isConst, class A>
+        View<T, isConst, A> operator()(const View<T, isConst, A>&, const std::size_t) const;
+
+private:
+    bool flat_;
+    std::size_t dimension_;
+    std::size_t extent_;
+    std::size_t numberOfChunks_;
+};
+
+template<class T, bool isConst, class A>
+inline
+ViewPartition::ViewPartition
+(
+    const View<T, isConst, A>& v,
+    const std::size_t numberOfChunks,
+    const bool flat
+)
+:   flat_(flat),
+    dimension_(0),
+    extent_(v.size()),
+    numberOfChunks_(1)
+{
+    if(v.dimension() != 0) {
+        if(!flat_) {
+            for(std::size_t j=1; j<v.dimension(); ++j) {
+                if(v.shape(j) > 1 && (v.shape(dimension_) == 1 
+                || v.strides(j) > v.strides(dimension_))) {
+                    dimension_ = j;
+                }
+            }
+            extent_ = v.shape(dimension_);
+        }
+        numberOfChunks_ = std::max<std::size_t>(std::min(numberOfChunks, extent_), 1);
+    }
+}
+
+template<class T, bool isConst, class A>
+inline View<T, isConst, A>
+ViewPartition::operator()
+(
+    const View<T, isConst, A>& v,
+    const std::size_t j
+) const
+{
+    if(numberOfChunks_ == 1) {
+        return v;
+    }
+    else if(flat_) {
+        const std::size_t shape[] = {end(j) - begin(j)};
+        return View<T, isConst, A>(shape, shape + 1, &v(0) + begin(j));
+    }
+    else {
+        std::vector<std::size_t> base(v.dimension());
+        std::vector<std::size_t> shape(v.shapeBegin(), v.shapeEnd());
+        base[dimension_] = begin(j);
+        shape[dimension_] = end(j) - begin(j);
+        return v.view(base.begin(), shape.begin());
+    }
+}
+
+// kernels for contiguous intervals of memory
+//
+// For the built-in in-place functors and the arithmetic types in TypeTraits
+// (except long double), the kernels are vectorized explicitly by means of
+// the vector extensions of GCC and Clang. On x86, AVX2 and AVX-512 versions
+// are selected at runtime if supported by the CPU. All other combinations
+// of functors and types are processed by a plain loop.
+
+template<class Functor>
+struct SimdFunctor
+{
+    static const bool supported = false;
+};
+
+// The unary and binary functors of expression templates whose vectorized
+// version SimdExpressionFunctor<Functor>::apply(x) resp. apply(x, y) 
+// overwrites x by the result are supported. An expression is evaluated in 
+// vectors if all its functors are supported and all its operands have the
+// same type, cf. the member function vectorAt() of the expression templates.
+template<class Functor>
+struct SimdExpressionFunctor
+{
+    static const bool supported = false;
+};
+
+// Reductions whose vectorized version SimdReduction<Reduction>::apply(r, x)
+// updates the vector r of partial results by the vector x of entries, and
+// whose combine(r, s) combines two vectors of partial results, are 
+// supported, cf. reduceAllSerial().
+template<class Reduction>
+struct SimdReduction
+{
+    static const bool supported = false;
+};
+
+#ifdef MARRAY_SIMD
+template<class T>
+struct SimdFunctor<Negative<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V&) { x = -x; }
+};
+template<class T>
+struct SimdFunctor<PrefixIncrement<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V&) { x += 1; }
+};
+template<class T>
+struct SimdFunctor<PostfixIncrement<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V&) { x += 1; }
+};
+template<class T>
+struct SimdFunctor<PrefixDecrement<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V&) { x -= 1; }
+};
+template<class T>
+struct SimdFunctor<PostfixDecrement<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V&) { x -= 1; }
+};
+template<class T>
+struct SimdFunctor<Assign<T, T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = y; }
+};
+template<class T>
+struct SimdFunctor<PlusEqual<T, T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x += y; }
+};
+template<class T>
+struct SimdFunctor<MinusEqual<T, T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x -= y; }
+};
+template<class T>
+struct SimdFunctor<TimesEqual<T, T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x *= y; }
+};
+template<class T> // integer division is not supported by SIMD instructions
+struct SimdFunctor<DividedByEqual<T, T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x, const V& y) { x /= y; }
+};
+
+// elementary functions for vectors of float and double
+//
+// exp and log reduce the argument by means of the binary representation
+// of floating point numbers and evaluate a polynomial on the reduced 
+// interval. The results of exp deviate from those of std::exp by up to 1,
+// those of log from std::log by up to 2 units in the last place (for 
+// arguments of log close to 1). Infinity, NaN, zero and subnormal 
+// numbers are treated like in std::exp and std::log.
+
+template<class T>
+struct SimdMath;
+
+template<>
+struct SimdMath<float> {
+    typedef std::int32_t integer_type;
+    static const int mantissaBits = 23;
+    static const int exponentBias = 127;
+    static const std::size_t expDegree = 7; // Taylor polynomial
+    static const std::size_t logDegree = 5; // series of atanh
+    static float ln2High() { return 0.693359375f; }
+    static float ln2Low() { return -2.12194440e-4f; }
+    static float expMinimum() { return -104.0f; }
+    static float expMaximum() { return 89.0f; }
+    static float minimumNormal() { return 1.17549435e-38f; }
+};
+
+template<>
+struct SimdMath<double> {
+    typedef std::int64_t integer_type;
+    static const int mantissaBits = 52;
+    static const int exponentBias = 1023;
+    static const std::size_t expDegree = 13;
+    static const std::size_t logDegree = 11;
+    static double ln2High() { return 6.93145751953125e-1; }
+    static double ln2Low() { return 1.42860682030941723212e-6; }
+    static double expMinimum() { return -746.0; }
+    static double expMaximum() { return 710.0; }
+    static double minimumNormal() { return 2.2250738585072014e-308; }
+};
+
+// x = a where mask is set
+template<class M, class V>
+__attribute__((always_inline)) inline void 
+simdWhere
+(
+    const M& mask, 
+    const V& a, 
+    V& x
+)
+{
+    x = (V)((mask & (M)a) | (~mask & (M)x));
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdAbs
+(
+    V& x
+)
+{
+    typedef decltype(x < x) I;
+    const I sign = I() + std::numeric_limits<typename SimdMath<T>::integer_type>::min();
+    x = (V)((I)x & ~sign);
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdFloor
+(
+    V& x
+)
+{
+    typedef SimdMath<T> M;
+    typedef decltype(x < x) I;
+    const I sign = I() + std::numeric_limits<typename SimdMath<T>::integer_type>::min();
+    const V large = V() + static_cast<T>(static_cast<typename M::integer_type>(1) << M::mantissaBits);
+    const V a = (V)((I)x & ~sign);
+    V t = (a + large) - large; // |x| rounded to the nearest integer
+    t = (V)((I)t | ((I)x & sign));
+    simdWhere(t > x, t - static_cast<T>(1), t);
+    simdWhere(a < large, t, x); // larger numbers, infinity and NaN remain
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdCeil
+(
+    V& x
+)
+{
+    x = -x;
+    simdFloor<T>(x);
+    x = -x;
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdSqrt
+(
+    V& x
+)
+{
+    for(std::size_t j=0; j<sizeof(V)/sizeof(T); ++j) {
+        x[j] = std::sqrt(x[j]);
+    }
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdExp
+(
+    V& x
+)
+{
+    typedef SimdMath<T> M;
+    typedef decltype(x < x) I;
+    const T log2e = static_cast<T>(1.44269504088896340736);
+    const T magic = static_cast<T>(3) * static_cast<T>(
+        static_cast<typename M::integer_type>(1) << (M::mantissaBits - 1));
+    const V minimum = V() + M::expMinimum();
+    const V maximum = V() + M::expMaximum();
+    simdWhere(x < minimum, minimum, x);
+    simdWhere(x > maximum, maximum, x);
+
+    // x = n ln(2) + r with an integer n and |r| <= ln(2)/2
+    const V t = x * log2e + magic;
+    const V n = t - magic;
+    const I k = (I)t - (I)(V() + magic);
+    V r = x - n * M::ln2High();
+    r = r - n * M::ln2Low();
+
+    // exp(r) by its Taylor polynomial
+    T coefficients[M::expDegree + 1];
+    coefficients[0] = static_cast<T>(1);
+    for(std::size_t j=1; j<=M::expDegree; ++j) {
+        coefficients[j] = coefficients[j-1] / static_cast<T>(j);
+    }
+    V p = V() + coefficients[M::expDegree];
+    for(std::size_t j=M::expDegree; j>0; --j) {
+        p = p * r + coefficients[j-1];
+    }
+
+    // exp(x) = exp(r) 2^n where 2^n is a product of two powers of 2 such
+    // that both are normal numbers
+    const I k1 = k >> 1;
+    const I k2 = k - k1;
+    x = p * (V)((k1 + M::exponentBias) << M::mantissaBits)
+        * (V)((k2 + M::exponentBias) << M::mantissaBits);
+}
+
+template<class T, class V>
+__attribute__((always_inline)) inline void 
+simdLog
+(
+    V& x
+)
+{
+    typedef SimdMath<T> M;
+    typedef decltype(x < x) I;
+    typedef typename M::integer_type Integer;
+    const V zero = V();
+    const T magic = static_cast<T>(3) * static_cast<T>(
+        static_cast<Integer>(1) << (M::mantissaBits - 1));
+    const Integer mantissaMask = (static_cast<Integer>(1) << M::mantissaBits) - 1;
+    const Integer exponentMask = 2 * M::exponentBias + 1;
+
+    // x = m 2^e with sqrt(1/2) <= m < sqrt(2). subnormal numbers are scaled
+    // by 2^mantissaBits first
+    const I subnormal = (x < M::minimumNormal()) & (x > zero);
+    V y = x;
+    simdWhere(subnormal, x * static_cast<T>(static_cast<Integer>(1) << M::mantissaBits), y);
+    const I bits = (I)y;
+    I e = ((bits >> M::mantissaBits) & exponentMask) - M::exponentBias;
+    e = e - (subnormal & M::mantissaBits);
+    V m = (V)((bits & mantissaMask) | (static_cast<Integer>(M::exponentBias) << M::mantissaBits));
+    const I large = m > static_cast<T>(1.41421356237309504880);
+    simdWhere(large, m * static_cast<T>(0.5), m);
+    e = e - large; // large is -1 where set
+
+    // log(m) = 2 atanh(s) = 2 (s + s^3/3 + s^5/5 + ...) with s = (m-1)/(m+1)
+    const V f = m - static_cast<T>(1);
+    const V s = f / (f + static_cast<T>(2));
+    const V s2 = s * s;
+    V q = V() + static_cast<T>(1) / static_cast<T>(2 * M::logDegree + 1);
+    for(std::size_t j=M::logDegree; j>0; --j) {
+        q = q * s2 + static_cast<T>(1) / static_cast<T>(2 * j - 1);
+    }
+    const V logm = static_cast<T>(2) * s * q;
+
+    // log(x) = e ln(2) + log(m)
+    const V ef = (V)(e + (I)(V() + magic)) - magic;
+    V result = ef * M::ln2High() + (logm + ef * M::ln2Low());
+    simdWhere(x == zero, V() - std::numeric_limits<T>::infinity(), result);
+    simdWhere(x < zero, V() + std::numeric_limits<T>::quiet_NaN(), result);
+    simdWhere(x == V() + std::numeric_limits<T>::infinity(), x, result);
+    simdWhere(x == x, result, x); // NaN remains
+}
+
+template<class T>
+struct SimdExpressionFunctor<Negate<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& x) { x = -x; }
+};
+template<class T>
+struct SimdExpressionFunctor<Abs<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdAbs<T>(x); }
+};
+template<class T>
+struct SimdExpressionFunctor<Exp<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdExp<T>(x); }
+};
+template<class T>
+struct SimdExpressionFunctor<Log<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdLog<T>(x); }
+};
+template<class T>
+struct SimdExpressionFunctor<Sqrt<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdSqrt<T>(x); }
+};
+template<class T>
+struct SimdExpressionFunctor<Floor<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdFloor<T>(x); }
+};
+template<class T>
+struct SimdExpressionFunctor<Ceil<T> > {
+    static const bool supported = TypeTraits<T>::position == 8 
+        || TypeTraits<T>::position == 9;
+    template<class V> static void apply(V& x) { simdCeil<T>(x); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Plus<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = x + y; }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Minus<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = x - y; }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Times<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = x * y; }
+};
+template<class T1, class T2, class U> // integer division is not supported by SIMD instructions
+struct SimdExpressionFunctor<DividedBy<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position == 8 
+        || TypeTraits<U>::position == 9;
+    template<class V> static void apply(V& x, const V& y) { x = x / y; }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Minimum<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { simdWhere(y < x, y, x); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Maximum<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { simdWhere(x < y, y, x); }
+};
+
+// comparisons yield vectors of masks in which all bits of an entry are 
+// set or unset. These are consumed by SelectViewExpression::vectorAt()
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Less<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x < y); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<LessEqual<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x <= y); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<Greater<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x > y); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<GreaterEqual<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x >= y); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<EqualTo<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x == y); }
+};
+template<class T1, class T2, class U>
+struct SimdExpressionFunctor<NotEqualTo<T1, T2, U> > {
+    static const bool supported = TypeTraits<U>::position < 10;
+    template<class V> static void apply(V& x, const V& y) { x = (V)(x != y); }
+};
+
+template<class T>
+struct SimdReduction<SumReduction<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& r, const V& x) { r += x; }
+    template<class V> static void combine(V& r, const V& s) { r += s; }
+};
+template<class T>
+struct SimdReduction<SquaredNormReduction<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& r, const V& x) { r += x * x; }
+    template<class V> static void combine(V& r, const V& s) { r += s; }
+};
+template<class T>
+struct SimdReduction<MinimumReduction<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& r, const V& x) { simdWhere(x < r, x, r); }
+    template<class V> static void combine(V& r, const V& s) { simdWhere(s < r, s, r); }
+};
+template<class T>
+struct SimdReduction<MaximumReduction<T> > {
+    static const bool supported = TypeTraits<T>::position < 10;
+    template<class V> static void apply(V& r, const V& x) { simdWhere(r < x, x, r); }
+    template<class V> static void combine(V& r, const V& s) { simdWhere(r < s, s, r); }
+};
+
+// vector loop over an interval of memory. If data is 0, the second operand
+// is the scalar x, otherwise it is the interval starting at data. 
+// SimdFunctor<Functor>::apply is used also for the remaining entries.
+template<std::size_t BYTES, class Functor, class T>
+__attribute__((always_inline)) inline void 
+simdLoop
+(
+    T* out,
+    const T* data,
+    const T& x,
+    const std::size_t size
+)
+{
+    typedef T Vector __attribute__((vector_size(BYTES)));
+    const std::size_t length = BYTES / sizeof(T);
+    std::size_t j = 0;
+    if(data == 0) {
+        Vector y = Vector() + x;
+        for(; j+length <= size; j += length) {
+            Vector v;
+            __builtin_memcpy(&v, out + j, BYTES);
+            SimdFunctor<Functor>::apply(v, y);
+            __builtin_memcpy(out + j, &v, BYTES);
+        }
+        for(; j<size; ++j) {
+            SimdFunctor<Functor>::apply(out[j], x);
+        }
+    }
+    else {
+        for(; j+length <= size; j += length) {
+            Vector v;
+            Vector w;
+            __builtin_memcpy(&v, out + j, BYTES);
+            __builtin_memcpy(&w, data + j, BYTES);
+            SimdFunctor<Functor>::apply(v, w);
+            __builtin_memcpy(out + j, &v, BYTES);
+        }
+        for(; j<size; ++j) {
+            SimdFunctor<Functor>::apply(out[j], data[j]);
+        }
+    }
+}
+
+// vector loop evaluating a simple expression at the entries from begin to
+// end of an interval of memory. Returns the first entry not processed.
+template<std::size_t BYTES, class Functor, class T, class E>
+__attribute__((always_inline)) inline std::size_t
+simdExpressionLoop
+(
+    T* out,
+    const E& e,
+    const std::size_t begin,
+    const std::size_t end
+)
+{
+    typedef T Vector __attribute__((vector_size(BYTES)));
+    const std::size_t length = BYTES / sizeof(T);
+    std::size_t j = begin;
+    for(; j+length <= end; j += length) {
+        Vector v;
+        Vector w;
+        __builtin_memcpy(&v, out + j, BYTES);
+        e.vectorAt(j, w);
+        SimdFunctor<Functor>::apply(v, w);
+        __builtin_memcpy(out + j, &v, BYTES);
+    }
+    return j;
+}
+
+// vector loop reducing the entries from begin to end of a simple expression
+// or of a contiguous row of an expression iterator e, i.e. the vectors 
+// e.vectorAt(j, x). Independent vector accumulators, each starting from 
+// initial in every entry, break the chain of dependencies between 
+// consecutive updates. Their entries are combined into r. Returns the 
+// first entry not processed.
+template<std::size_t BYTES, class R, class E, class Reduction>
+__attribute__((always_inline)) inline std::size_t
+simdReduceLoop
+(
+    const E& e,
+    const std::size_t begin,
+    const std::size_t end,
+    const R& initial,
+    R& r,
+    Reduction reduction
+)
+{
+    typedef R Vector __attribute__((vector_size(BYTES)));
+    const std::size_t length = BYTES / sizeof(R);
+    const std::size_t M = 4; // number of accumulators
+    std::size_t j = begin;
+    if(j + length > end) {
+        return j;
+    }
+    Vector accumulator[M];
+    for(std::size_t k=0; k<M; ++k) {
+        accumulator[k] = Vector() + initial;
+    }
+    for(; j+M*length <= end; j += M*length) {
+        for(std::size_t k=0; k<M; ++k) {
+            Vector x;
+            e.vectorAt(j + k*length, x);
+            SimdReduction<Reduction>::apply(accumulator[k], x);
+        }
+    }
+    for(; j+length <= end; j += length) {
+        Vector x;
+        e.vectorAt(j, x);
+        SimdReduction<Reduction>::apply(accumulator[0], x);
+    }
+    for(std::size_t k=1; k<M; ++k) {
+        SimdReduction<Reduction>::combine(accumulator[0], accumulator[k]);
+    }
+    R entries[length];
+    __builtin_memcpy(entries, &accumulator[0], BYTES);
+    for(std::size_t k=0; k<length; ++k) {
+        reduction.combine(r, entries[k]);
+    }
+    return j;
+}
+
+#ifdef MARRAY_SIMD_X86
+template<class Functor, class T>
+__attribute__((target("avx2"))) inline void
+simdLoopAvx2(T* out, const T* data, const T& x, const std::size_t size)
+{
+    simdLoop<32, Functor>(out, data, x, size);
+}
+
+template<class Functor, class T>
+__attribute__((target("avx512f,avx512bw"))) inline void
+simdLoopAvx512(T* out, const T* data, const T& x, const std::size_t size)
+{
+    simdLoop<64, Functor>(out, data, x, size);
+}
+
+template<class Functor, class T, class E>
+__attribute__((target("avx2"))) inline std::size_t
+simdExpressionLoopAvx2(T* out, const E& e, const std::size_t begin, const std::size_t end)
+{
+    return simdExpressionLoop<32, Functor>(out, e, begin, end);
+}
+
+template<class R, class E, class Reduction>
+__attribute__((target("avx2"))) inline std::size_t
+simdReduceLoopAvx2(const E& e, const std::size_t begin, const std::size_t end, 
+    const R& initial, R& r, Reduction reduction)
+{
+    return simdReduceLoop<32>(e, begin, end, initial, r, reduction);
+}
+
+// 0: SSE2, 1: AVX2, 2: AVX-512
+inline int
+simdLevel()
+{
+    static const int level = 
+        __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") ? 2
+        : __builtin_cpu_supports("avx2") ? 1 : 0;
+    return level;
+}
+#endif
+
+template<class Functor, class T>
+inline void
+simdOperate
+(
+    T* out,
+    const T* data,
+    const T& x,
+    const std::size_t size
+)
+{
+#ifdef MARRAY_SIMD_X86
+    const int level = simdLevel();
+    if(level == 2) {
+        simdLoopAvx512<Functor>(out, data, x, size);
+    }
+    else if(level == 1) {
+        simdLoopAvx2<Functor>(out, data, x, size);
+    }
+    else {
+        simdLoop<16, Functor>(out, data, x, size);
+    }
+#else
+    simdLoop<16, Functor>(out, data, x, size);
+#endif
+}
+
+template<class Functor, class T, class E>
+inline std::size_t
+simdEvaluate
+(
+    T* out,
+    const E& e,
+    const std::size_t begin,
+    const std::size_t end
+)
+{
+#ifdef MARRAY_SIMD_X86
+    const int level = simdLevel();
+    if(level >= 1) { // comparisons of 512-bit vectors are not vectorized by GCC
+        return simdExpressionLoopAvx2<Functor>(out, e, begin, end);
+    }
+    else {
+        return simdExpressionLoop<16, Functor>(out, e, begin, end);
+    }
+#else
+    return simdExpressionLoop<16, Functor>(out, e, begin, end);
+#endif
+}
+
+template<class R, class E, class Reduction>
+inline std::size_t
+simdReduce
+(
+    const E& e,
+    const std::size_t begin,
+    const std::size_t end,
+    const R& initial,
+    R& r,
+    Reduction reduction
+)
+{
+#ifdef MARRAY_SIMD_X86
+    if(simdLevel() >= 1) { // like simdEvaluate()
+        return simdReduceLoopAvx2(e, begin, end, initial, r, reduction);
+    }
+    else {
+        return simdReduceLoop<16>(e, begin, end, initial, r, reduction);
+    }
+#else
+    return simdReduceLoop<16>(e, begin, end, initial, r, reduction);
+#endif
+}
+#endif // #ifdef MARRAY_SIMD
+
+template<bool SIMD>
+struct ContiguousHelper
+{
+    template<class Functor, class T>
+    static void operate(T* data, const std::size_t size, Functor f)
+    {
+        for(std::size_t j=0; j<size; ++j) {
+            f(data[j]);
+        }
+    }
+
+    template<class Functor, class T1, class T2>
+    static void operate(T1* data, const std::size_t size, const T2& x, Functor f)
+    {
+        for(std::size_t j=0; j<size; ++j) {
+            f(data[j], x);
+        }
+    }
+
+    template<class Functor, class T1, class T2>
+    static void operate(T1* dataV, const T2* dataW, const std::size_t size, Functor f)
+    {
+        for(std::size_t j=0; j<size; ++j) {
+            f(dataV[j], dataW[j]);
+        }
+    }
+};
+
+#ifdef MARRAY_SIMD
+template<>
+struct ContiguousHelper<true>
+{
+    template<class Functor, class T>
+    static void operate(T* data, const std::size_t size, Functor)
+    {
+        simdOperate<Functor>(data, static_cast<const T*>(0), T(), size);
+    }
+
+    template<class Functor, class T>
+    static void operate(T* data, const std::size_t size, const T& x, Functor)
+    {
+        simdOperate<Functor>(data, static_cast<const T*>(0), x, size);
+    }
+
+    template<class Functor, class T>
+    static void operate(T* dataV, const T* dataW, const std::size_t size, Functor)
+    {
+        simdOperate<Functor>(dataV, dataW, T(), size);
+    }
+};
+#endif
+
+// evaluation of simple expressions, cf. operateSerial(). Returns the first 
+// entry that remains to be processed by the caller.
+template<bool SIMD>
+struct ExpressionHelper
+{
+    template<class Functor, class T, class E>
+    static std::size_t operate(T*, const E&, const std::size_t begin, const std::size_t)
+    {
+        return begin;
+    }
+};
+
+#ifdef MARRAY_SIMD
+template<>
+struct ExpressionHelper<true>
+{
+    template<class Functor, class T, class E>
+    static std::size_t operate(T* data, const E& e, const std::size_t begin, const std::size_t end)
+    {
+        return simdEvaluate<Functor>(data, e, begin, end);
+    }
+};
+#endif
+
+// vectorized reduction of simple expressions and of contiguous rows, cf. 
+// reduceAllSerial(). Returns the first entry that remains to be processed
+// by the caller.
+template<bool SIMD>
+struct ReductionHelper
+{
+    template<class R, class E, class Reduction>
+    static std::size_t reduce(const E&, const std::size_t begin, const std::size_t,
+        const R&, R&, Reduction)
+    {
+        return begin;
+    }
+};
+
+#ifdef MARRAY_SIMD
+template<>
+struct ReductionHelper<true>
+{
+    template<class R, class E, class Reduction>
+    static std::size_t reduce(const E& e, const std::size_t begin, const std::size_t end,
+        const R& initial, R& r, Reduction reduction)
+    {
+        return simdReduce(e, begin, end, initial, r, reduction);
+    }
+};
+#endif
+
+template<class Functor, class T>
+inline void 
+operateContiguous
+(
+    T* data,
+    const std::size_t size,
+    Functor f
+)
+{
+    ContiguousHelper<SimdFunctor<Functor>::supported>::operate(data, size, f);
+}
+
+template<class Functor, class T1, class T2>
+inline void 
+operateContiguous
+(
+    T1* data,
+    const std::size_t size,
+    const T2& x,
+    Functor f
+)
+{
+    ContiguousHelper<SimdFunctor<Functor>::supported>::operate(data, size, x, f);
+}
+
+template<class Functor, class T1, class T2>
+inline void 
+operateContiguous
+(
+    T1* dataV,
+    const T2* dataW,
+    const std::size_t size,
+    Functor f
+)
+{
+    ContiguousHelper<SimdFunctor<Functor>::supported>::operate(dataV, dataW, size, f);
+}
+
+// scratch memory for temporaries
+//
+// Temporary copies made inside the library (of operands that overlap
+// the result of an operation) are allocated by means of ScratchAllocator.
+// Memory freed by such temporaries is not returned to the system but kept 
+// in a cache of the calling thread, up to scratchCapacity() bytes, and is
+// re-used by subsequent temporaries. Sizes of blocks that can be cached 
+// are rounded up to powers of 2 such that temporaries of similar size share
+// blocks. Larger blocks are allocated with their exact size and freed 
+// directly.
+
+inline std::atomic<std::size_t>&
+scratchCapacitySetting()
+{
+    static std::atomic<std::size_t> capacity(std::size_t(1) << 26);
+    return capacity;
+}
+
+class ScratchArena
+{
+public:
+    static ScratchArena& local();
+
+    ScratchArena();
+    ~ScratchArena();
+
+    void* allocate(const std::size_t);
+    void deallocate(void*, const std::size_t);
+    void trim(const std::size_t);
+
+private:
+    static const std::size_t numberOfSizeClasses = 64;
+    static const std::size_t minimumSizeClass = 6; // 64 bytes
+
+    ScratchArena(const ScratchArena&); // non-copyable
+    ScratchArena& operator=(const ScratchArena&); // non-copyable
+
+    static std::size_t sizeClass(const std::size_t);
+
+    std::vector<void*> blocks_[numberOfSizeClasses];
+    std::vector<void*> uncachedBlocks_; // allocated with their exact size
+    std::size_t cachedSize_;
+};
+
+inline ScratchArena&
+ScratchArena::local()
+{
+    static thread_local ScratchArena arena;
+    return arena;
+}
+
+inline
+ScratchArena::ScratchArena()
+:   uncachedBlocks_(),
+    cachedSize_(0)
+{}
+
+inline
+ScratchArena::~ScratchArena()
+{
+    trim(0);
+}
+
+// smallest k such that 2^k >= size
+inline std::size_t
+ScratchArena::sizeClass
+(
+    const std::size_t size
+)
+{
+    std::size_t k = minimumSizeClass;
+    while((std::size_t(1) << k) < size) {
+        ++k;
+    }
+    return k;
+}
+
+inline void*
+ScratchArena::allocate
+(
+    const std::size_t size
+)
+{
+    if(size > (std::size_t(1) << (numberOfSizeClasses - 2))) {
+        throw std::bad_alloc();
+    }
+    const std::size_t k = sizeClass(size);
+    if((std::size_t(1) << k) > scratchCapacitySetting()) { // cannot be cached
+        void* p = ::operator new(size);
+        uncachedBlocks_.push_back(p);
+        return p;
+    }
+    if(!blocks_[k].empty()) {
+        void* p = blocks_[k].back();
+        blocks_[k].pop_back();
+        cachedSize_ -= std::size_t(1) << k;
+        return p;
+    }
+    return ::operator new(std::size_t(1) << k);
+}
+
+inline void
+ScratchArena::deallocate
+(
+    void* p,
+    const std::size_t size
+)
+{
+    const std::size_t capacity = scratchCapacitySetting();
+    if(cachedSize_ > capacity) { // capacity was reduced by another thread
+        trim(capacity);
+    }
+    std::vector<void*>::iterator it = 
+        std::find(uncachedBlocks_.begin(), uncachedBlocks_.end(), p);
+    if(it != uncachedBlocks_.end()) { // block has its exact size
+        uncachedBlocks_.erase(it);
+        ::operator delete(p);
+        return;
+    }
+    const std::size_t k = sizeClass(size);
+    if(cachedSize_ + (std::size_t(1) << k) <= capacity) {
+        blocks_[k].push_back(p);
+        cachedSize_ += std::size_t(1) << k;
+    }
+    else {
+        ::operator delete(p);
+    }
+}
+
+// frees cached blocks, largest first, until at most size bytes are cached
+inline void
+ScratchArena::trim
+(
+    const std::size_t size
+)
+{
+    for(std::size_t k=numberOfSizeClasses; k>0 && cachedSize_>size; --k) {
+        std::vector<void*>& blocks = blocks_[k - 1];
+        while(!blocks.empty() && cachedSize_ > size) {
+            ::operator delete(blocks.back());
+            blocks.pop_back();
+            cachedSize_ -= std::size_t(1) << (k - 1);
+        }
+    }
+}
+
+// allocator for temporaries, cf. ScratchArena. Instances are stateless;
+// memory can be freed by any instance on the thread that allocated it.
+template<class T>
+class ScratchAllocator
+{
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    template<class U> 
+        struct rebind { typedef ScratchAllocator<U> other; };
+
+    ScratchAllocator()
+        {}
+    template<class U>
+        ScratchAllocator(const ScratchAllocator<U>&)
+            {}
+
+    pointer allocate(const size_type n, const void* = 0)
+        { 
+            if(n == 0) {
+                return 0;
+            }
+            if(n > max_size()) {
+                throw std::bad_alloc();
+            }
+            return static_cast<pointer>(ScratchArena::local().allocate(n * sizeof(T))); 
+        }
+    void deallocate(pointer p, const size_type n)
+        { 
+            if(p != 0) {
+                ScratchArena::local().deallocate(p, n * sizeof(T)); 
+            }
+        }
+    size_type max_size() const
+        { return (std::size_t(1) << 62) / sizeof(T); }
+};
+
+template<class T1, class T2>
+inline bool
+operator==
+(
+    const ScratchAllocator<T1>&,
+    const ScratchAllocator<T2>&
+)
+{
+    return true;
+}
+
+template<class T1, class T2>
+inline bool
+operator!=
+(
+    const ScratchAllocator<T1>&,
+    const ScratchAllocator<T2>&
+)
+{
+    return false;
+}
+
+// fills and copies of contiguous intervals of memory
+//
+// Writes of at least streamingThreshold() bytes bypass the cache by means
+// of non-temporal stores (SSE2). Fills and copies are parallelized with 
+// the same threshold as all other operations, cf. numberOfChunks().
+
+inline std::atomic<std::size_t>&
+streamingThresholdSetting()
+{
+    static std::atomic<std::size_t> threshold(std::numeric_limits<std::size_t>::max());
+    return threshold;
+}
+
+#ifdef MARRAY_STREAMING
+template<class T>
+inline void
+streamFill
+(
+    T* data,
+    const std::size_t size,
+    const T& value
+)
+{
+    const std::size_t length = 16 / sizeof(T);
+    std::size_t j = 0;
+    if(reinterpret_cast<std::uintptr_t>(data) % sizeof(T) == 0) {
+        for(; j<size && reinterpret_cast<std::uintptr_t>(data + j) % 16 != 0; ++j) {
+            data[j] = value;
+        }
+        T pattern[length];
+        for(std::size_t k=0; k<length; ++k) {
+            pattern[k] = value;
+        }
+        __m128i x;
+        memcpy(&x, pattern, 16);
+        for(; j + length <= size; j += length) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(data + j), x);
+        }
+        _mm_sfence();
+    }
+    for(; j<size; ++j) {
+        data[j] = value;
+    }
+}
+
+inline void
+streamCopy
+(
+    char* to,
+    const char* from,
+    const std::size_t size
+)
+{
+    std::size_t j = std::min<std::size_t>(
+        (16 - reinterpret_cast<std::uintptr_t>(to) % 16) % 16, size);
+    memcpy(to, from, j);
+    for(; j + 16 <= size; j += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + j));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to + j), x);
+    }
+    _mm_sfence();
+    memcpy(to + j, from + j, size - j);
+}
+#endif
+
+// set size entries starting at data to value
+template<class T>
+inline void
+fillContiguous
+(
+    T* data,
+    const std::size_t size,
+    const T& value
+)
+{
+#ifdef MARRAY_STREAMING
+    const bool streaming = TypeTraits<T>::position < 10
+        && size * sizeof(T) >= streamingThresholdSetting();
+#endif
+    const std::size_t n = numberOfChunks(size);
+    parallelFor(n, [&](const std::size_t j) {
+        const std::size_t begin = (size * j) / n;
+        const std::size_t end = (size * (j+1)) / n;
+#ifdef MARRAY_STREAMING
+        if(streaming) {
+            streamFill(data + begin, end - begin, value);
+            return;
+        }
+#endif
+        operateContiguous(data + begin, end - begin, value, Assign<T, T>());
+    });
+}
+
+// copy size entries of entrySize bytes each (as memcpy)
+inline void
+copyContiguous
+(
+    void* to,
+    const void* from,
+    const std::size_t size,
+    const std::size_t entrySize
+)
+{
+#ifdef MARRAY_STREAMING
+    const bool streaming = size * entrySize >= streamingThresholdSetting();
+#endif
+    const std::size_t n = numberOfChunks(size);
+    parallelFor(n, [&](const std::size_t j) {
+        const std::size_t begin = entrySize * ((size * j) / n);
+        const std::size_t end = entrySize * ((size * (j+1)) / n);
+        char* p = static_cast<char*>(to) + begin;
+        const char* q = static_cast<const char*>(from) + begin;
+#ifdef MARRAY_STREAMING
+        if(streaming) {
+            streamCopy(p, q, end - begin);
+            return;
+        }
+#endif
+        memcpy(p, q, end - begin);
+    });
+}
+
+// first touch of memory for size entries that are not initialized, in 
+// parallel and with the same partition as fillContiguous() and all other
+// operations on contiguous memory, such that the pages of each chunk are 
+// placed on the NUMA node of the thread that processes the chunk later, 
+// cf. ThreadPool::work(). Only entries of trivial types are touched, by 
+// writing one byte per page.
+template<class T>
+inline void
+touchContiguous
+(
+    T* data,
+    const std::size_t size
+)
+{
+    const std::size_t n = numberOfChunks(size);
+    if(!std::is_trivial<T>::value || n == 1) {
+        return;
+    }
+    const std::size_t pageSize = 4096;
+    parallelFor(n, [&](const std::size_t j) {
+        char* begin = reinterpret_cast<char*>(data + (size * j) / n);
+        char* end = reinterpret_cast<char*>(data + (size * (j+1)) / n);
+        for(char* p = begin; p < end; p += pageSize) {
+            *p = 0;
+        }
+    });
+}
+
+// huge pages for large arrays
+//
+// Memory of at least hugePageThreshold() bytes is advised to be backed by 
+// transparent huge pages (on Linux), which reduces TLB misses in traversals
+// of multi-GB arrays. The advice is given before the memory is first 
+// touched and is ignored by the kernel if huge pages are not available.
+
+inline std::atomic<std::size_t>&
+hugePageThresholdSetting()
+{
+    static std::atomic<std::size_t> threshold(std::numeric_limits<std::size_t>::max());
+    return threshold;
+}
+
+inline void
+adviseHugePages
+(
+    void* data,
+    const std::size_t size
+)
+{
+#ifdef MARRAY_HUGE_PAGES
+    if(data == 0 || size < hugePageThresholdSetting()) {
+        return;
+    }
+    const std::uintptr_t pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    const std::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(data) + pageSize - 1) 
+        & ~(pageSize - 1);
+    const std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(data) + size) 
+        & ~(pageSize - 1);
+    if(begin < end) {
+        madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+// memory for size entries from allocator, advised to be backed by huge 
+// pages if large and touched in parallel unless it is initialized 
+// (in parallel) by the caller
+template<class A>
+inline typename A::pointer
+allocateContiguous
+(
+    A& allocator,
+    const std::size_t size,
+    const bool initialized
+)
+{
+    typename A::pointer data = allocator.allocate(size);
+    adviseHugePages(data, size * sizeof(typename A::value_type));
+    if(!initialized) {
+        touchContiguous(data, size);
+    }
+    return data;
+}
+
+// Sorts the dimensions of N operands of equal shape by increasing strides 
+// of the first operand (the destination); ties are broken by the strides of 
+// the subsequent operands. The shape and the strides are permuted in place
+// such that the traversal by operateStrided(), whose innermost loop runs
+// over dimension 0, accesses the destination in the order of memory. 
+template<std::size_t N>
+inline void
+orderDimensions
+(
+    const std::size_t dimension,
+    std::size_t* shape,
+    std::size_t* (&strides)[N]
+)
+{
+    for(std::size_t j=1; j<dimension; ++j) { // insertion sort (stable)
+        for(std::size_t i=j; i>0; --i) {
+            bool less = false;
+            for(std::size_t k=0; k<N; ++k) {
+                if(strides[k][i] != strides[k][i-1]) {
+                    less = strides[k][i] < strides[k][i-1];
+                    break;
+                }
+            }
+            if(!less) {
+                break;
+            }
+            std::swap(shape[i], shape[i-1]);
+            for(std::size_t k=0; k<N; ++k) {
+                std::swap(strides[k][i], strides[k][i-1]);
+            }
+        }
+    }
+}
+
+// Merges adjacent dimensions of N operands of equal shape that can be 
+// traversed as a single dimension by all operands and removes singleton 
+// dimensions. The shape and the strides of the operands are modified 
+// in place. The new dimension is returned.
+template<std::size_t N>
+inline std::size_t
+coalesceDimensions
+(
+    const std::size_t dimension,
+    std::size_t* shape,
+    std::size_t* (&strides)[N]
+)
+{
+    std::size_t d = 0;
+    for(std::size_t j=0; j<dimension; ++j) {
+        if(shape[j] == 1) {
+            continue;
+        }
+        if(d != 0) {
+            bool inner = true; // dimension d-1 is inside dimension j
+            bool outer = true; // dimension d-1 is outside dimension j
+            for(std::size_t k=0; k<N; ++k) {
+                inner = inner && strides[k][j] == shape[d-1] * strides[k][d-1];
+                outer = outer && strides[k][d-1] == shape[j] * strides[k][j];
+            }
+            if(inner || outer) {
+                shape[d-1] *= shape[j];
+                if(!inner) {
+                    for(std::size_t k=0; k<N; ++k) {
+                        strides[k][d-1] = strides[k][j];
+                    }
+                }
+                continue;
+            }
+        }
+        shape[d] = shape[j];
+        for(std::size_t k=0; k<N; ++k) {
+            strides[k][d] = strides[k][j];
+        }
+        ++d;
+    }
+    return d;
+}
+
+inline std::ptrdiff_t
+floorDivide
+(
+    const std::ptrdiff_t a,
+    const std::ptrdiff_t b // positive
+)
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+inline std::ptrdiff_t
+ceilDivide
+(
+    const std::ptrdiff_t a,
+    const std::ptrdiff_t b // positive
+)
+{
+    return a >= 0 ? (a + b - 1) / b : -((-a) / b);
+}
+
+// Checks whether a sum x_0 c_0 + ... + x_{n-1} c_{n-1} of integers 
+// 0 <= x_j <= bounds[j] lies in the interval [lower, upper]. The positive
+// coefficients c_j are sorted in descending order. reach[j] is the largest 
+// sum of the terms j, ..., n-1, and divisor[j] is the greatest common 
+// divisor of their coefficients. The depth-first search is aborted once 
+// its budget is exhausted, in which case true is returned conservatively.
+inline bool
+boundedSumInInterval
+(
+    const std::size_t n,
+    const std::ptrdiff_t* coefficients,
+    const std::ptrdiff_t* bounds,
+    const std::ptrdiff_t* reach,
+    const std::ptrdiff_t* divisor,
+    const std::ptrdiff_t lower,
+    const std::ptrdiff_t upper,
+    std::size_t& budget
+)
+{
+    if(n == 0) {
+        return lower <= 0 && 0 <= upper;
+    }
+    if(budget == 0) {
+        return true;
+    }
+    --budget;
+    // the sum is a multiple of divisor[0] between 0 and reach[0]
+    const std::ptrdiff_t a = std::max<std::ptrdiff_t>(lower, 0);
+    const std::ptrdiff_t b = std::min(upper, reach[0]);
+    if(a > b || floorDivide(b, divisor[0]) < ceilDivide(a, divisor[0])) {
+        return false;
+    }
+    const std::ptrdiff_t c = coefficients[0];
+    const std::ptrdiff_t rest = (n == 1 ? 0 : reach[1]);
+    const std::ptrdiff_t xBegin = std::max<std::ptrdiff_t>(ceilDivide(lower - rest, c), 0);
+    const std::ptrdiff_t xEnd = std::min(floorDivide(upper, c), bounds[0]);
+    for(std::ptrdiff_t x=xBegin; x<=xEnd; ++x) {
+        if(boundedSumInInterval(n - 1, coefficients + 1, bounds + 1, reach + 1, 
+            divisor + 1, lower - x * c, upper - x * c, budget)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Checks whether two strided sets of entries share at least one byte.
+// The entries of the first set are located at the byte offsets 
+// sum_j i_j * stridesV[j] * entrySizeV with 0 <= i_j < shapeV[j] and 
+// occupy entrySizeV bytes each. The entries of the second set are located
+// at offset + sum_j i_j * stridesW[j] * entrySizeW. The test is exact 
+// unless the number of steps of the search exceeds a fixed budget, in 
+// which case true is returned.
+inline bool
+intersect
+(
+    const std::size_t dimensionV,
+    const std::size_t* shapeV,
+    const std::size_t* stridesV,
+    const std::size_t entrySizeV,
+    const std::size_t dimensionW,
+    const std::size_t* shapeW,
+    const std::size_t* stridesW,
+    const std::size_t entrySizeW,
+    const std::ptrdiff_t offset
+)
+{
+    // entries overlap iff 
+    //     -entrySizeW < offset + sum_j k_j stridesW[j] - sum_j i_j stridesV[j] < entrySizeV
+    // with k'_j = shapeW[j] - 1 - k_j, all coefficients are positive.
+    typedef std::pair<std::ptrdiff_t, std::ptrdiff_t> Term; // (coefficient, bound)
+    SmallVector<Term, 2 * MARRAY_INLINE_DIMENSION> terms(dimensionV + dimensionW);
+    std::size_t n = 0;
+    std::ptrdiff_t shift = 0;
+    for(std::size_t j=0; j<dimensionV; ++j) {
+        if(shapeV[j] > 1 && stridesV[j] != 0) {
+            terms[n] = Term(static_cast<std::ptrdiff_t>(stridesV[j] * entrySizeV),
+                static_cast<std::ptrdiff_t>(shapeV[j] - 1));
+            ++n;
+        }
+    }
+    for(std::size_t j=0; j<dimensionW; ++j) {
+        if(shapeW[j] > 1 && stridesW[j] != 0) {
+            terms[n] = Term(static_cast<std::ptrdiff_t>(stridesW[j] * entrySizeW),
+                static_cast<std::ptrdiff_t>(shapeW[j] - 1));
+            shift += terms[n].first * terms[n].second;
+            ++n;
+        }
+    }
+    std::sort(terms.begin(), terms.begin() + n, std::greater<Term>());
+    typedef SmallVector<std::ptrdiff_t, 2 * MARRAY_INLINE_DIMENSION + 1> Buffer;
+    Buffer coefficients(n + 1), bounds(n + 1), reach(n + 1), divisor(n + 1);
+    for(std::size_t j=n; j>0; --j) {
+        coefficients[j-1] = terms[j-1].first;
+        bounds[j-1] = terms[j-1].second;
+        reach[j-1] = reach[j] + coefficients[j-1] * bounds[j-1];
+        std::ptrdiff_t a = coefficients[j-1];
+        std::ptrdiff_t b = divisor[j];
+        while(b != 0) {
+            const std::ptrdiff_t r = a % b;
+            a = b;
+            b = r;
+        }
+        divisor[j-1] = a;
+    }
+    std::size_t budget = 1 << 12;
+    return boundedSumInInterval(n, &coefficients[0], &bounds[0], &reach[0], &divisor[0],
+        offset + shift - static_cast<std::ptrdiff_t>(entrySizeV) + 1,
+        offset + shift + static_cast<std::ptrdiff_t>(entrySizeW) - 1, budget);
+}
+
+// sequences of indices for the expansion of tuples
+template<std::size_t... I>
+struct IndexSequence
+{};
+
+template<std::size_t N, std::size_t... I>
+struct MakeIndexSequence
+: public MakeIndexSequence<N-1, N-1, I...>
+{};
+
+template<std::size_t... I>
+struct MakeIndexSequence<0, I...>
+{
+    typedef IndexSequence<I...> type;
+};
+
+// add n times the stride in dimension j to the pointers to the operands
+template<class... P, std::size_t... I>
+inline void
+advance
+(
+    std::tuple<P...>& data,
+    const std::size_t* const* strides,
+    const std::size_t j,
+    const std::ptrdiff_t n,
+    IndexSequence<I...>
+)
+{
+    const int expand[] = {0, (std::get<I>(data) += n * static_cast<std::ptrdiff_t>(strides[I][j]), 0)...};
+    static_cast<void>(expand);
+}
+
+// Traversal of any number of operands of equal shape whose dimensions have 
+// been ordered and coalesced. strides[k] is the array of strides of operand
+// k, and data holds pointers to the first entries of the operands. For 
+// every coordinate, f is called with one entry of each operand. If all
+// operands are contiguous in dimension 0, the innermost loop indexes the
+// operands directly such that it can be vectorized by the compiler.
+template<class Functor, class... P, std::size_t... I>
+inline void
+traverse
+(
+    const std::size_t dimension,
+    const std::size_t* shape,
+    const std::size_t* const* strides,
+    std::tuple<P...> data,
+    Functor& f,
+    IndexSequence<I...> indices
+)
+{
+    bool contiguous = true;
+    for(std::size_t k=0; k<sizeof...(P); ++k) {
+        contiguous = contiguous && strides[k][0] == 1;
+    }
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+    for(;;) {
+        if(contiguous) {
+            for(std::size_t j=0; j<shape[0]; ++j) {
+                f(std::get<I>(data)[j]...);
+            }
+        }
+        else {
+            std::tuple<P...> p = data;
+            for(std::size_t j=0; j<shape[0]; ++j) {
+                f(*std::get<I>(p)...);
+                advance(p, strides, 0, 1, indices);
+            }
+        }
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            if(coordinate[j] + 1 < shape[j]) {
+                ++coordinate[j];
+                advance(data, strides, j, 1, indices);
+                break;
+            }
+            advance(data, strides, j, -static_cast<std::ptrdiff_t>(coordinate[j]), indices);
+            coordinate[j] = 0;
+        }
+        if(j == dimension) {
+            return;
+        }
+    }
+}
+
+// assigns the result of a functor to the first argument
+template<class Functor>
+struct TransformFunctor
+{
+    TransformFunctor(Functor f)
+        : f_(f) {}
+    template<class U, class... Args>
+        void operator()(U& out, const Args&... args)
+            { out = f_(args...); }
+
+    Functor f_;
+};
+
+// edge length of square tiles of entries of types T1 and T2 such that the 
+// entries of one tile of both operands fit into the L1 cache (32 KiB)
+template<class T1, class T2>
+inline std::size_t
+blockSize()
+{
+    std::size_t n = 8;
+    while(4 * n * n * (sizeof(T1) + sizeof(T2)) <= 32768) {
+        n *= 2;
+    }
+    return n;
+}
+
+// Cache-blocked traversal of two operands whose innermost dimensions differ.
+//
+// The dimensions are expected to be ordered by the strides of the first
+// operand (the destination), cf. orderDimensions(), such that dimension 0 
+// is the innermost dimension of the destination and dimension q is the 
+// innermost dimension of the source. These two dimensions are traversed 
+// in square tiles whose entries fit into the L1 cache, such that every 
+// cache line of the source and the destination that is loaded is used 
+// completely. All other dimensions are traversed in an outer loop.
+template<class Functor, class T1, class T2>
+inline void
+operateBlocked
+(
+    const std::size_t dimension,
+    const std::size_t q,
+    const std::size_t* shape,
+    const std::size_t* stridesV,
+    const std::size_t* stridesW,
+    T1* dataV,
+    const T2* dataW,
+    Functor f
+)
+{
+    const std::size_t n = blockSize<T1, T2>();
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+    for(;;) {
+        for(std::size_t b=0; b<shape[0]; b+=n) {
+            const std::size_t e = std::min(b + n, shape[0]);
+            for(std::size_t bq=0; bq<shape[q]; bq+=n) {
+                const std::size_t eq = std::min(bq + n, shape[q]);
+                for(std::size_t jq=bq; jq<eq; ++jq) {
+                    T1* pV = dataV + jq * stridesV[q] + b * stridesV[0];
+                    const T2* pW = dataW + jq * stridesW[q] + b * stridesW[0];
+                    for(std::size_t j=b; j<e; ++j) {
+                        f(*pV, *pW);
+                        pV += stridesV[0];
+                        pW += stridesW[0];
+                    }
+                }
+            }
+        }
+        // increment the coordinate in all other dimensions
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            if(j == q) {
+                continue;
+            }
+            if(coordinate[j] + 1 < shape[j]) {
+                ++coordinate[j];
+                dataV += stridesV[j];
+                dataW += stridesW[j];
+                break;
+            }
+            dataV -= coordinate[j] * stridesV[j];
+            dataW -= coordinate[j] * stridesW[j];
+            coordinate[j] = 0;
+        }
+        if(j == dimension) {
+            return;
+        }
+    }
+}
+
+template<class Functor, class T, class A>
+inline void 
+operate
+(
+    View<T, false, A>& v, 
+    Functor f
+)
+{
+    const std::size_t n = numberOfChunks(v.size());
+    if(n == 1) {
+        operateSerial(v, f);
+    }
+    else {
+        const ViewPartition partition(v, n, v.isSimple());
+        parallelFor(partition.size(), [&](const std::size_t j) {
+            View<T, false, A> chunk = partition(v, j);
+            operateSerial(chunk, f);
+        });
+    }
+}
+
+template<class Functor, class T, class A>
+inline void 
+operateSerial
+(
+    View<T, false, A>& v, 
+    Functor f
+)
+{
+    if(v.isSimple()) {
+        operateContiguous(&v(0), v.size(), f);
+    }
+    else {
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> shape(v.shapeBegin(), v.shapeEnd());
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> strides(v.stridesBegin(), v.stridesEnd());
+        std::size_t* s[] = {&strides[0]};
+        orderDimensions(v.dimension(), &shape[0], s);
+        const std::size_t dimension = coalesceDimensions(v.dimension(), &shape[0], s);
+        if(dimension == 0) {
+            f(v(0));
+        }
+        else {
+            operateStrided(dimension, &shape[0], &strides[0], &v(0), f);
+        }
+    }
+}
+
+// Traversal of an operand of any dimension. The innermost loop runs over 
+// dimension 0, all other dimensions are traversed by an odometer.
+template<class Functor, class T>
+inline void 
+operateStrided
+(
+    const std::size_t dimension,
+    const std::size_t* shape,
+    const std::size_t* strides,
+    T* data,
+    Functor f
+)
+{
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+    for(;;) {
+        if(strides[0] == 1) {
+            operateContiguous(data, shape[0], f);
+        }
+        else {
+            T* p = data;
+            for(std::size_t j=0; j<shape[0]; ++j) {
+                f(*p);
+                p += strides[0];
+            }
+        }
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            if(coordinate[j] + 1 < shape[j]) {
+                ++coordinate[j];
+                data += strides[j];
+                break;
+            }
+            data -= coordinate[j] * strides[j];
+            coordinate[j] = 0;
+        }
+        if(j == dimension) {
+            return;
+        }
+    }
+}
+
+template<class Functor, class T, class A>
+inline void 
+operate
+(
+    View<T, false, A>& v, 
+    const T& x, 
+    Functor f
+)
+{
+    operateScalar(v, x, f);
+}
+
+template<class Functor, class T1, class T2, class A>
+inline void 
+operateScalar
+(
+    View<T1, false, A>& v, 
+    const T2& x, 
+    Functor f
+)
+{
+    const std::size_t n = numberOfChunks(v.size());
+    if(n == 1) {
+        operateSerial(v, x, f);
+    }
+    else {
+        const ViewPartition partition(v, n, v.isSimple());
+        parallelFor(partition.size(), [&](const std::size_t j) {
+            View<T1, false, A> chunk = partition(v, j);
+            operateSerial(chunk, x, f);
+        });
+    }
+}
+
+template<class Functor, class T1, class T2, class A>
+inline void 
+operateSerial
+(
+    View<T1, false, A>& v, 
+    const T2& x, 
+    Functor f
+)
+{
+    if(v.isSimple()) {
+        operateContiguous(&v(0), v.size(), x, f);
+    }
+    else {
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> shape(v.shapeBegin(), v.shapeEnd());
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> strides(v.stridesBegin(), v.stridesEnd());
+        std::size_t* s[] = {&strides[0]};
+        orderDimensions(v.dimension(), &shape[0], s);
+        const std::size_t dimension = coalesceDimensions(v.dimension(), &shape[0], s);
+        if(dimension == 0) {
+            f(v(0), x);
+        }
+        else {
+            operateStrided(dimension, &shape[0], &strides[0], &v(0), x, f);
+        }
+    }
+}
+
+template<class Functor, class T1, class T2>
+inline void 
+operateStrided
+(
+    const std::size_t dimension,
+    const std::size_t* shape,
+    const std::size_t* strides,
+    T1* data,
+    const T2& x,
+    Functor f
+)
+{
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+    for(;;) {
+        if(strides[0] == 1) {
+            operateContiguous(data, shape[0], x, f);
+        }
+        else {
+            T1* p = data;
+            for(std::size_t j=0; j<shape[0]; ++j) {
+                f(*p, x);
+                p += strides[0];
+            }
+        }
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            if(coordinate[j] + 1 < shape[j]) {
+                ++coordinate[j];
+                data += strides[j];
+                break;
+            }
+            data -= coordinate[j] * strides[j];
+            coordinate[j] = 0;
+        }
+        if(j == dimension) {
+            return;
+        }
+    }
+}
+
+template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+inline void 
+operate
+(
+    View<T1, false, A1>& v, 
+    const View<T2, isConst, A2>& w, 
+    Functor f
+)
+{
+    if(!MARRAY_NO_ARG_TEST) {
+        // w is broadcast to the shape of v, cf. View::broadcastedView()
+        Assert(v.size() != 0 && w.size() != 0);
+        Assert(w.dimension() <= v.dimension());
+        const std::size_t skip = v.dimension() - w.dimension();
+        for(std::size_t j=0; j<w.dimension(); ++j) {
+            Assert(w.shape(j) == v.shape(j + skip) || w.shape(j) == 1);
+        }
+    }
+    if(w.dimension() == 0) {
+        T2 x = w(0);
+        operateScalar(v, x, f);
+    }
+    else if(w.dimension() != v.dimension() 
+    || !std::equal(w.shapeBegin(), w.shapeEnd(), v.shapeBegin())) {
+        if(v.overlaps(w)) {
+            Marray<T2, ScratchAllocator<std::size_t> > m(w); // temporary copy of the smaller operand
+            operate(v, m, f); // recursive call
+        }
+        else {
+            operate(v, w.broadcastedView(v.shapeBegin(), v.shapeEnd()), f); // recursive call
+        }
+    }
+    else if(v.overlaps(w)) {
+        if(!operateInPlace(v, w, f)) {
+            Marray<T2, ScratchAllocator<std::size_t> > m(w); // temporary copy
+            operate(v, m, f); // recursive call
+        }
+    }
+    else {
+        const std::size_t n = numberOfChunks(v.size());
+        if(n == 1) {
+            operateSerial(v, w, f);
+        }
+        else {
+            const bool flat = v.coordinateOrder() == w.coordinateOrder() 
+                && v.isSimple() && w.isSimple();
+            const ViewPartition partition(v, n, flat);
+            parallelFor(partition.size(), [&](const std::size_t j) {
+                View<T1, false, A1> chunkV = partition(v, j);
+                View<T2, isConst, A2> chunkW = partition(w, j);
+                operateSerial(chunkV, chunkW, f);
+            });
+        }
+    }
+}
+
+template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+inline void 
+operateSerial
+(
+    View<T1, false, A1>& v, 
+    const View<T2, isConst, A2>& w, 
+    Functor f
+)
+{
+    if(v.coordinateOrder() == w.coordinateOrder() 
+        && v.isSimple() && w.isSimple()) {
+        operateContiguous(&v(0), &w(0), v.size(), f);
+    }
+    else {
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> shape(v.shapeBegin(), v.shapeEnd());
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> stridesV(v.stridesBegin(), v.stridesEnd());
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> stridesW(w.stridesBegin(), w.stridesEnd());
+        std::size_t* s[] = {&stridesV[0], &stridesW[0]};
+        orderDimensions(v.dimension(), &shape[0], s);
+        const std::size_t dimension = coalesceDimensions(v.dimension(), &shape[0], s);
+        std::size_t q = 0; // innermost dimension of the source, not broadcast
+        for(std::size_t j=1; j<dimension; ++j) {
+            if(stridesW[j] != 0 && stridesW[j] < stridesW[q]) {
+                q = j;
+            }
+        }
+        if(dimension == 0) {
+            f(v(0), w(0));
+        }
+        else if(q != 0) {
+            operateBlocked(dimension, q, &shape[0], &stridesV[0], &stridesW[0], 
+                &v(0), &w(0), f);
+        }
+        else {
+            operateStrided(dimension, &shape[0], &stridesV[0], &stridesW[0], 
+                &v(0), &w(0), f);
+        }
+    }
+}
+
+// Operates on overlapping Views v and w without a temporary copy, in the
+// manner of memmove. This is possible if v and w have the same strides and
+// entries of the same size, i.e. if w is v shifted in memory by a whole 
+// number of entries. The entries are then traversed in increasing order 
+// of memory if v precedes w and in decreasing order otherwise, such that
+// every entry of w is read before it is overwritten. The function returns
+// false, without operating, if this is not possible.
+template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
+inline bool
+operateInPlace
+(
+    View<T1, false, A1>& v, 
+    const View<T2, isConst, A2>& w, 
+    Functor f
+)
+{
+    if(sizeof(T1) != sizeof(T2) || v.dimension() != w.dimension()) {
+        return false;
+    }
+    for(std::size_t j=0; j<v.dimension(); ++j) {
+        if(v.strides(j) != w.strides(j)) {
+            return false;
+        }
+    }
+    const std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(
+        reinterpret_cast<std::uintptr_t>(&v(0)) - reinterpret_cast<std::uintptr_t>(&w(0)));
+    if(offset % static_cast<std::ptrdiff_t>(sizeof(T1)) != 0) {
+        return false;
+    }
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> shape(v.shapeBegin(), v.shapeEnd());
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> strides(v.stridesBegin(), v.stridesEnd());
+    std::size_t* s[] = {&strides[0]};
+    orderDimensions(v.dimension(), &shape[0], s);
+    const std::size_t dimension = coalesceDimensions(v.dimension(), &shape[0], s);
+    if(dimension == 0) {
+        f(v(0), w(0));
+        return true;
+    }
+    // the traversal must address the entries in strictly increasing order
+    std::size_t span = 0;
+    for(std::size_t j=0; j<dimension; ++j) {
+        if(strides[j] <= span) {
+            return false;
+        }
+        span += strides[j] * (shape[j] - 1);
+    }
+    T1* dataV = &v(0);
+    const T2* dataW = &w(0);
+    const bool backward = offset > 0;
+    const std::size_t n = shape[0];
+    const std::size_t stride = strides[0];
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> c(dimension);
+    std::size_t outer = 0; // offset of the innermost loop
+    for(;;) {
+        if(backward) {
+            std::size_t k = span - outer;
+            for(std::size_t i=0; i<n; ++i, k-=stride) {
+                f(dataV[k], dataW[k]);
+            }
+        }
+        else {
+            std::size_t k = outer;
+            for(std::size_t i=0; i<n; ++i, k+=stride) {
+                f(dataV[k], dataW[k]);
+            }
+        }
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            outer += strides[j];
+            if(++c[j] < shape[j]) {
+                break;
+            }
+            outer -= strides[j] * shape[j];
+            c[j] = 0;
+        }
+        if(j == dimension) {
+            return true;
+        }
+    }
+}
+
+template<class Functor, class T1, class T2>
+inline void 
+operateStrided
+(
+    const std::size_t dimension,
+    const std::size_t* shape,
+    const std::size_t* stridesV,
+    const std::size_t* stridesW,
+    T1* dataV,
+    const T2* dataW,
+    Functor f
+)
+{
+    SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+    for(;;) {
+        if(stridesV[0] == 1 && stridesW[0] == 1) {
+            operateContiguous(dataV, dataW, shape[0], f);
+        }
+        else {
+            T1* pV = dataV;
+            const T2* pW = dataW;
+            for(std::size_t j=0; j<shape[0]; ++j) {
+                f(*pV, *pW);
+                pV += stridesV[0];
+                pW += stridesW[0];
+            }
+        }
+        std::size_t j = 1;
+        for(; j<dimension; ++j) {
+            if(coordinate[j] + 1 < shape[j]) {
+                ++coordinate[j];
+                dataV += stridesV[j];
+                dataW += stridesW[j];
+                break;
+            }
+            dataV -= coordinate[j] * stridesV[j];
+            dataW -= coordinate[j] * stridesW[j];
+            coordinate[j] = 0;
+        }
+        if(j == dimension) {
+            return;
+        }
+    }
+}
+
+// the dimension along which operateSerial() traverses the rows of v: the 
+// non-singleton dimension of smallest stride, i.e. the first dimension for 
+// LastMajorOrder and the last dimension for FirstMajorOrder
+template<class T, bool isConst, class A>
+inline std::size_t
+rowDimension
+(
+    const View<T, isConst, A>& v
+)
+{
+    std::size_t d = 0;
+    for(std::size_t j=1; j<v.dimension(); ++j) {
+        if(v.shape(j) != 1 && (v.shape(d) == 1 || v.strides(j) < v.strides(d))) {
+            d = j;
+        }
+    }
+    return d;
+}
+
+// the dimension along which reduceAllSerial() traverses the rows of an 
+// expression other than a View, whose strides are not known: the first
+// non-singleton dimension for LastMajorOrder and the last for 
+// FirstMajorOrder
+template<class E, class T>
+inline std::size_t
+rowDimension
+(
+    const ViewExpression<E, T>& expression
+)
+{
+    const E& e = expression; // cast
+    const std::size_t dimension = e.dimension();
+    if(e.coordinateOrder() == LastMajorOrder) {
+        for(std::size_t j=0; j<dimension; ++j) {
+            if(e.shape(j) != 1) {
+                return j;
+            }
+        }
+        return 0;
+    }
+    else {
+        for(std::size_t j=dimension; j>0; --j) {
+            if(e.shape(j - 1) != 1) {
+                return j - 1;
+            }
+        }
+        return dimension - 1;
+    }
+}
+
+template<class Functor, class T1, class A, class E, class T2>
+inline void operate
+(
+    View<T1, false, A>& v, 
+    const ViewExpression<E, T2>& expression, 
+    Functor f
+)
+{
+    const E& e = expression; // cast
+    if(!MARRAY_NO_DEBUG) {
+        // e is broadcast to the shape of v, cf. View::broadcastedView()
+        Assert(v.size() != 0 && e.size() != 0);
+        Assert(e.dimension() <= v.dimension());
+        if(v.dimension() == 0) {
+            Assert(v.size() == 1 && e.size() == 1);
+        }
+        else {
+            const std::size_t skip = v.dimension() - e.dimension();
+            for(std::size_t j=0; j<e.dimension(); ++j) {
+                Assert(v.shape(j + skip) == e.shape(j) || e.shape(j) == 1);
+            }
+        }
+    }
+    if(e.overlapsOtherEntries(v)) { // e.g. not for v = v * 2 + w
+        Marray<T1, ScratchAllocator<std::size_t> > m(e); // temporary copy
+        operate(v, m, f);
+    }
+    else if(v.dimension() == 0) {
+        f(v[0], e[0]);
+    }
+    else {
+        // the simple case is partitioned into intervals of memory, the 
+        // general case into intervals of rows along rowDimension(v),
+        // or into intervals of the only row, cf. operateSerial()
+        const bool simple = v.isSimple() && e.isSimple() 
+            && v.coordinateOrder() == e.coordinateOrder()
+            && v.size() == e.size();
+        const std::size_t extent = simple || v.dimension() == 1 ? v.size() 
+            : v.size() / v.shape(rowDimension(v));
+        const std::size_t n = std::min(numberOfChunks(v.size()), extent);
+        if(n == 1) {
+            operateSerial(v, e, f, 0, extent);
+        }
+        else {
+            parallelFor(n, [&](const std::size_t j) {
+                operateSerial(v, e, f, (extent * j) / n, (extent * (j+1)) / n);
+            });
+        }
+    }
+}
+
+// begin and end delimit an interval of memory if v and the expression are
+// simple. Otherwise, they delimit an interval of the rows along 
+// rowDimension(v), numbered such that the remaining dimension of lowest 
+// index changes fastest, or an interval of the only row if v has one 
+// dimension.
+template<class Functor, class T1, class A, class E, class T2>
+inline void operateSerial
+(
+    View<T1, false, A>& v, 
+    const ViewExpression<E, T2>& expression, 
+    Functor f,
+    const std::size_t begin,
+    const std::size_t end
+)
+{
+    const E& e = expression; // cast
+    const bool simd = SimdFunctor<Functor>::supported && E::vectorizable
+        && IsEqual<T1, T2>::type && IsEqual<T2, typename E::vector_value_type>::type;
+    if(v.isSimple() && e.isSimple() 
+    && v.coordinateOrder() == e.coordinateOrder()
+    && v.size() == e.size()) {
+        std::size_t j = ExpressionHelper<simd>::template operate<Functor>(&v[0], e, begin, end);
+        for(; j<end; ++j) {
+            f(v[j], e[j]);
+        }
+    }
+    else {
+        // e is traversed as broadcast to the shape of v, row by row. The 
+        // loop over a row accesses the entries of all operands at fixed 
+        // strides and is vectorized if all these strides are 1 or 0.
+        typename E::ExpressionIterator itE(e, v.dimension(), v.shapeBegin());
+        const std::size_t d = rowDimension(v);
+        itE.setRowDimension(d);
+        const std::size_t strideV = v.strides(d);
+        const bool vectorize = simd && strideV == 1 && itE.isContiguous();
+        std::size_t entryBegin = 0;
+        std::size_t entryEnd = v.shape(d);
+        std::size_t rowBegin = begin;
+        std::size_t rowEnd = end;
+        if(v.dimension() == 1) {
+            entryBegin = begin;
+            entryEnd = end;
+            rowBegin = 0;
+            rowEnd = 1;
+        }
+        std::size_t offsetV = 0;
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(v.dimension());
+        for(std::size_t j=0, r=rowBegin; j<v.dimension(); ++j) {
+            if(j == d) {
+                continue;
+            }
+            coordinate[j] = r % v.shape(j);
+            r /= v.shape(j);
+            for(std::size_t k=0; k<coordinate[j]; ++k) {
+                itE.incrementCoordinate(j);
+            }
+            offsetV += coordinate[j] * v.strides(j);
+        }
+        for(std::size_t row=rowBegin; ; ) {
+            T1* out = &v[offsetV];
+            std::size_t k = entryBegin;
+            if(vectorize) {
+                k = ExpressionHelper<simd>::template operate<Functor>(out, itE, entryBegin, entryEnd);
+            }
+            for(; k<entryEnd; ++k) {
+                f(out[k * strideV], itE.at(k));
+            }
+            if(++row == rowEnd) {
+                return;
+            }
+            for(std::size_t j=0; j<v.dimension(); ++j) {
+                if(j == d) {
+                    continue;
+                }
+                if(coordinate[j] + 1 == v.shape(j)) {
+                    offsetV -= coordinate[j] * v.strides(j);
+                    itE.resetCoordinate(j);
+                    coordinate[j] = 0;
+                }
+                else {
+                    offsetV += v.strides(j);
+                    itE.incrementCoordinate(j);
+                    ++coordinate[j];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Reduces all entries of an expression. r = initial is updated by 
+// reduction(r, x) for every entry x, and partial results r and s are
+// combined by reduction.combine(r, s). Every partial result starts from
+// initial which therefore has to be neutral, like 0 for a sum, or an 
+// entry of the expression, like for the minimum. Like operate(), the 
+// work is split among threads, simple expressions into intervals of 
+// memory, all others into intervals of the rows along rowDimension(e).
+template<class E, class T, class R, class Reduction>
+inline R
+reduceAll
+(
+    const ViewExpression<E, T>& expression,
+    const R& initial,
+    Reduction reduction
+)
+{
+    const E& e = expression; // cast
+    const bool simple = e.dimension() == 0 || e.isSimple();
+    const std::size_t extent = simple || e.dimension() == 1 ? e.size()
+        : e.size() / e.shape(rowDimension(e));
+    const std::size_t n = std::min(numberOfChunks(e.size()), extent);
+    if(n == 1) {
+        return reduceAllSerial(e, initial, reduction, 0, extent);
+    }
+    else {
+        SmallVector<R, 64> partial(n);
+        parallelFor(n, [&](const std::size_t j) {
+            partial[j] = reduceAllSerial(e, initial, reduction, 
+                (extent * j) / n, (extent * (j+1)) / n);
+        });
+        R r = partial[0];
+        for(std::size_t j=1; j<n; ++j) {
+            reduction.combine(r, partial[j]);
+        }
+        return r;
+    }
+}
+
+// Reduces the entries of an expression with indices in [begin, end) if 
+// the expression is simple. Otherwise, begin and end delimit an interval 
+// of the rows along rowDimension(e), numbered such that the remaining 
+// dimension of lowest index changes fastest, or an interval of the only 
+// row if the expression has one dimension, cf. operateSerial(). Simple 
+// expressions and contiguous rows are reduced in vectors if possible.
+template<class E, class T, class R, class Reduction>
+inline R
+reduceAllSerial
+(
+    const ViewExpression<E, T>& expression,
+    const R& initial,
+    Reduction reduction,
+    const std::size_t begin,
+    const std::size_t end
+)
+{
+    const E& e = expression; // cast
+    const bool simd = SimdReduction<Reduction>::supported && E::vectorizable
+        && IsEqual<T, R>::type && IsEqual<R, typename E::vector_value_type>::type;
+    R r = initial;
+    if(e.dimension() == 0 || e.isSimple()) {
+        std::size_t j = ReductionHelper<simd>::reduce(e, begin, end, initial, r, reduction);
+        // independent accumulators for entries that are not reduced in 
+        // vectors, e.g. of Float16 or long double
+        const std::size_t M = 8;
+        R s[M];
+        s[0] = r;
+        for(std::size_t k=1; k<M; ++k) {
+            s[k] = initial;
+        }
+        for(; j + M <= end; j += M) {
+            for(std::size_t k=0; k<M; ++k) {
+                reduction(s[k], e[j + k]);
+            }
+        }
+        for(; j<end; ++j) {
+            reduction(s[0], e[j]);
+        }
+        for(std::size_t k=1; k<M; ++k) {
+            reduction.combine(s[0], s[k]);
+        }
+        return s[0];
+    }
+    else {
+        typename E::ExpressionIterator itE(e);
+        const std::size_t d = rowDimension(e);
+        itE.setRowDimension(d);
+        const bool vectorize = simd && itE.isContiguous();
+        std::size_t entryBegin = 0;
+        std::size_t entryEnd = e.shape(d);
+        std::size_t rowBegin = begin;
+        std::size_t rowEnd = end;
+        if(e.dimension() == 1) {
+            entryBegin = begin;
+            entryEnd = end;
+            rowBegin = 0;
+            rowEnd = 1;
+        }
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(e.dimension());
+        for(std::size_t j=0, row=rowBegin; j<e.dimension(); ++j) {
+            if(j == d) {
+                continue;
+            }
+            coordinate[j] = row % e.shape(j);
+            row /= e.shape(j);
+            for(std::size_t k=0; k<coordinate[j]; ++k) {
+                itE.incrementCoordinate(j);
+            }
+        }
+        for(std::size_t row=rowBegin; ; ) {
+            std::size_t k = entryBegin;
+            if(vectorize) {
+                k = ReductionHelper<simd>::reduce(itE, entryBegin, entryEnd, initial, r, reduction);
+            }
+            for(; k<entryEnd; ++k) {
+                reduction(r, itE.at(k));
+            }
+            if(++row == rowEnd) {
+                return r;
+            }
+            for(std::size_t j=0; j<e.dimension(); ++j) {
+                if(j == d) {
+                    continue;
+                }
+                if(coordinate[j] + 1 == e.shape(j)) {
+                    itE.resetCoordinate(j);
+                    coordinate[j] = 0;
+                }
+                else {
+                    itE.incrementCoordinate(j);
+                    ++coordinate[j];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Tests whether the predicate holds for any entry of an expression. The 
+// work is split among threads, simple expressions into intervals of 
+// memory, all others along the last dimension. All threads stop as soon 
+// as one of them finds an entry for which the predicate holds.
+template<class E, class T, class Predicate>
+inline bool
+anyOf
+(
+    const ViewExpression<E, T>& expression,
+    Predicate predicate
+)
+{
+    const E& e = expression; // cast
+    const bool simple = e.dimension() == 0 || e.isSimple();
+    const std::size_t extent = simple ? e.size() : e.shape(e.dimension() - 1);
+    const std::size_t n = std::min(numberOfChunks(e.size()), extent);
+    std::atomic<bool> found(false);
+    if(n == 1) {
+        anyOfSerial(e, predicate, 0, extent, found);
+    }
+    else {
+        parallelFor(n, [&](const std::size_t j) {
+            anyOfSerial(e, predicate, (extent * j) / n, (extent * (j+1)) / n, found);
+        });
+    }
+    return found.load();
+}
+
+// Sets found if the predicate holds for an entry of the expression with 
+// index in [begin, end) if the expression is simple and with last 
+// coordinate in [begin, end) otherwise. Returns early if found is set, 
+// also by another thread. In the simple case, found is tested once per 
+// block of entries, such that the loop over a block can be vectorized.
+template<class E, class T, class Predicate>
+inline void
+anyOfSerial
+(
+    const ViewExpression<E, T>& expression,
+    Predicate predicate,
+    const std::size_t begin,
+    const std::size_t end,
+    std::atomic<bool>& found
+)
+{
+    const E& e = expression; // cast
+    if(e.dimension() == 0 || e.isSimple()) {
+        const std::size_t blockSize = 256;
+        for(std::size_t j = begin; j < end; j += blockSize) {
+            if(found.load(std::memory_order_relaxed)) {
+                return;
+            }
+            const std::size_t blockEnd = std::min(j + blockSize, end);
+            bool any = false;
+            for(std::size_t k = j; k < blockEnd; ++k) {
+                any |= predicate(e[k]);
+            }
+            if(any) {
+                found.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+    else {
+        typename E::ExpressionIterator itE(e);
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(e.dimension());
+        const std::size_t maxDimension = e.dimension() - 1;
+        for(std::size_t j=0; j<begin; ++j) {
+            itE.incrementCoordinate(maxDimension);
+        }
+        coordinate[maxDimension] = begin;
+        for(;;) {
+            if(predicate(*itE)) {
+                found.store(true, std::memory_order_relaxed);
+                return;
+            }
+            for(std::size_t j=0; j<e.dimension(); ++j) {
+                if(coordinate[j]+1 == (j == maxDimension ? end : e.shape(j))) {
+                    if(j == maxDimension) {
+                        return;
+                    }
+                    else {
+                        itE.resetCoordinate(j);
+                        coordinate[j] = 0;
+                    }
+                }
+                else {
+                    itE.incrementCoordinate(j);
+                    ++coordinate[j];
+                    break;
+                }
+            }
+            if(coordinate[0] == 0 && found.load(std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+}
+
+// Reduces the entries p[0], p[stride], ... along an axis, cf. foldAxis().
+template<class T, class Functor>
+struct AxisFold
+{
+    AxisFold(const Functor& f, const std::size_t size, const std::size_t stride)
+        : f_(f), size_(size), stride_(stride) 
+        {}
+    void operator()(T& r, const T* p)
+        {
+            T y = p[0];
+            for(std::size_t k=1; k<size_; ++k) {
+                f_(y, p[k * stride_]);
+            }
+            r = y;
+        }
+
+    Functor f_;
+    std::size_t size_;
+    std::size_t stride_;
+};
+
+// Finds the index of the first entry along an axis which is not preceded
+// by an entry that compares better, cf. AxisFold.
+template<class T, class Compare>
+struct AxisArgFold
+{
+    AxisArgFold(const Compare& compare, const std::size_t size, const std::size_t stride)
+        : compare_(compare), size_(size), stride_(stride) 
+        {}
+    void operator()(std::size_t& r, const T* p)
+        {
+            T best = p[0];
+            std::size_t index = 0;
+            for(std::size_t k=1; k<size_; ++k) {
+                if(compare_(p[k * stride_], best)) {
+                    best = p[k * stride_];
+                    index = k;
+                }
+            }
+            r = index;
+        }
+
+    Compare compare_;
+    std::size_t size_;
+    std::size_t stride_;
+};
+
+// Updates the best entries and their indices by the k-th slice along
+// an axis.
+template<class T, class Compare>
+struct ArgUpdate
+{
+    ArgUpdate(const Compare& compare, const std::size_t k)
+        : compare_(compare), k_(k) 
+        {}
+    void operator()(T& best, std::size_t& index, const T& x)
+        {
+            if(compare_(x, best)) {
+                best = x;
+                index = k_;
+            }
+        }
+
+    Compare compare_;
+    std::size_t k_;
+};
+
+// Calls f(out[i], p) for every entry i of a simple Marray out that has the
+// shape and coordinate order of the View u, where p points to the entry of 
+// u at the same coordinates. The work, e.g. the number of entries of all 
+// slices that are read by f, is split among threads into intervals of 
+// indices of out.
+template<class Functor, class R, class AR, class T, bool isConst, class A>
+inline void
+foldAxis
+(
+    Marray<R, AR>& out,
+    const View<T, isConst, A>& u,
+    const std::size_t work,
+    Functor f
+)
+{
+    const std::size_t size = out.size();
+    const std::size_t dimension = u.dimension();
+    const std::size_t n = std::min(numberOfChunks(work), size);
+    R* r = &out(0);
+    const T* data = &u(0);
+    parallelFor(n, [&](const std::size_t j) {
+        const std::size_t begin = (size * j) / n;
+        const std::size_t end = (size * (j+1)) / n;
+        Functor g = f;
+        SmallVector<std::size_t, MARRAY_INLINE_DIMENSION> coordinate(dimension);
+        u.indexToCoordinates(begin, coordinate.begin());
+        std::size_t offset = 0;
+        u.coordinatesToOffset(coordinate.begin(), offset);
+        for(std::size_t index=begin; index<end; ++index) {
+            g(r[index], data + offset);
+            // next coordinate in the order of indices
+            for(std::size_t k=0; k<dimension; ++k) {
+                const std::size_t i = (u.coordinateOrder() == FirstMajorOrder) 
+                    ? dimension - 1 - k : k;
+                if(coordinate[i] + 1 < u.shape(i)) {
+                    ++coordinate[i];
+                    offset += u.strides(i);
+                    break;
+                }
+                offset -= coordinate[i] * u.strides(i);
+                coordinate[i] = 0;
+            }
+        }
+    });
+}
+
+// Checks whether the entries along an axis are closer in memory than 
+// the entries along any other non-singleton dimension.
+template<class T, bool isConst, class A>
+inline bool
+isInnermost
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis
+)
+{
+    for(std::size_t j=0; j<v.dimension(); ++j) {
+        if(j != axis && v.shape(j) > 1 && v.strides(j) < v.strides(axis)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reduces a View along an axis by an in-place functor f(r, x). If the 
+// axis is the innermost dimension in memory, every entry of the result
+// is computed by one pass along the axis. Otherwise, the result is 
+// initialized with the first slice along the axis, and the other slices
+// are folded into it one after the other, by operations that traverse 
+// slice and result in the order of memory. In both cases, the work is 
+// split among threads along the dimensions that are kept.
+template<class Functor, class T, bool isConst, class A>
+inline Marray<T, A>
+reduceAxis
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis,
+    Functor f
+)
+{
+    Assert(MARRAY_NO_ARG_TEST || (v.size() != 0 && axis < v.dimension()));
+    const std::size_t n = v.shape(axis);
+    if(v.dimension() == 1) {
+        T r = v(0);
+        for(std::size_t k=1; k<n; ++k) {
+            f(r, v(k));
+        }
+        return Marray<T, A>(r, v.coordinateOrder());
+    }
+    else if(isInnermost(v, axis)) {
+        const View<T, isConst, A> u = v.boundView(axis, 0);
+        Marray<T, A> out(SkipInitialization, u.shapeBegin(), u.shapeEnd(), 
+            v.coordinateOrder());
+        foldAxis(out, u, v.size(), AxisFold<T, Functor>(f, n, v.strides(axis)));
+        return out;
+    }
+    else {
+        Marray<T, A> out = v.boundView(axis, 0);
+        for(std::size_t k=1; k<n; ++k) {
+            operate(out, v.boundView(axis, k), f);
+        }
+        return out;
+    }
+}
+
+// Finds, along an axis, the index of the first entry x that is best in 
+// the sense that compare(y, x) is false for all entries y, cf. reduceAxis().
+template<class Compare, class T, bool isConst, class A>
+inline Marray<std::size_t, A>
+argReduceAxis
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis,
+    Compare compare
+)
+{
+    Assert(MARRAY_NO_ARG_TEST || (v.size() != 0 && axis < v.dimension()));
+    const std::size_t n = v.shape(axis);
+    if(v.dimension() == 1) {
+        T best = v(0);
+        std::size_t index = 0;
+        for(std::size_t k=1; k<n; ++k) {
+            if(compare(v(k), best)) {
+                best = v(k);
+                index = k;
+            }
+        }
+        return Marray<std::size_t, A>(index, v.coordinateOrder());
+    }
+    const View<T, isConst, A> u = v.boundView(axis, 0);
+    if(isInnermost(v, axis)) {
+        Marray<std::size_t, A> out(SkipInitialization, u.shapeBegin(), u.shapeEnd(), 
+            v.coordinateOrder());
+        foldAxis(out, u, v.size(), AxisArgFold<T, Compare>(compare, n, v.strides(axis)));
+        return out;
+    }
+    else {
+        Marray<std::size_t, A> out(u.shapeBegin(), u.shapeEnd(), 0, v.coordinateOrder());
+        Marray<T, A> best = u;
+        // out and best have the shape of the slices and are thus 
+        // partitioned consistently with them
+        const ViewPartition partition(u, numberOfChunks(v.size()), false);
+        parallelFor(partition.size(), [&](const std::size_t j) {
+            View<std::size_t, false, A> outChunk 
+                = partition(static_cast<View<std::size_t, false, A>&>(out), j);
+            View<T, false, A> bestChunk 
+                = partition(static_cast<View<T, false, A>&>(best), j);
+            for(std::size_t k=1; k<n; ++k) {
+                forEach(ArgUpdate<T, Compare>(compare, k), bestChunk, outChunk, 
+                    partition(v.boundView(axis, k), j));
+            }
+        });
+        return out;
+    }
+}
+
+} // namespace marray_detail
+// \endcond suppress_doxygen
+
+// implementation of parallel execution settings
+
+/// Set the number of threads used for operations on the entries of Views.
+///
+/// By default, all operations are executed by the calling thread.
+/// If the number of threads is set to n > 1, compound assignment
+/// (+=, -=, *=, /=, ++, --), assignment of scalars, Views and 
+/// ViewExpressions to Views and Marrays, and the construction of Marrays
+/// from Views and ViewExpressions are executed by n threads, provided 
+/// that at least parallelThreshold() entries are written. Each thread 
+/// processes a compact region of memory: Simple Views are partitioned
+/// into intervals of memory, all other Views along the dimension with 
+/// the largest stride.
+///
+/// Operations called from within a parallel operation or concurrently 
+/// with a parallel operation started from another thread are executed
+/// serially.
+///
+/// \param n Number of threads. If n is 0, one thread per hardware
+/// thread is used.
+///
+/// \sa numberOfThreads(), setParallelThreshold()
+///
+inline void
+setNumberOfThreads
+(
+    const std::size_t n
+)
+{
+    if(n == 0) {
+        marray_detail::parallelSettings().numberOfThreads 
+            = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    else {
+        marray_detail::parallelSettings().numberOfThreads = n;
+    }
+}
+
+/// Get the number of threads used for operations on the entries of Views.
+///
+/// \sa setNumberOfThreads()
+///
+inline std::size_t
+numberOfThreads()
+{
+    return marray_detail::parallelSettings().numberOfThreads;
+}
+
+/// Set the minimum number of entries for which operations are parallelized.
+///
+/// \param size Minimum number of entries. Operations on fewer entries
+/// are executed serially. The default is 2^18.
+///
+/// \sa parallelThreshold(), setNumberOfThreads()
+///
+inline void
+setParallelThreshold
+(
+    const std::size_t size
+)
+{
+    marray_detail::parallelSettings().threshold = size;
+}
+
+/// Get the minimum number of entries for which operations are parallelized.
+///
+/// \sa setParallelThreshold()
+///
+inline std::size_t
+parallelThreshold()
+{
+    return marray_detail::parallelSettings().threshold;
+}
+
+/// Set the minimum size of writes that bypass the cache.
+///
+/// Fills and copies of contiguous memory of at least this many bytes 
+/// use non-temporal stores (on x86 with SSE2) which do not evict other
+/// data from the cache hierarchy. This is beneficial for writes that are
+/// larger than the last-level cache and are not read again soon. This 
+/// affects Marray::operator=(const T&), the initialization of Marrays 
+/// upon construction and resize as well as copies of simple Views and
+/// Marrays of the same type and coordinate order. By default, all writes
+/// go through the cache.
+///
+/// \param size Minimum number of bytes.
+///
+/// \sa streamingThreshold(), setParallelThreshold()
+///
+inline void
+setStreamingThreshold
+(
+    const std::size_t size
+)
+{
+    marray_detail::streamingThresholdSetting() = size;
+}
+
+/// Get the minimum size of writes that bypass the cache.
+///
+/// \sa setStreamingThreshold()
+///
+inline std::size_t
+streamingThreshold()
+{
+    return marray_detail::streamingThresholdSetting();
+}
+
+/// Set the number of bytes each thread keeps for temporaries.
+///
+/// Operations whose operands overlap with the result, e.g. v = v + w for
+/// overlapping Views v and w, evaluate the operands into a temporary Marray
+/// first. The memory of such temporaries is kept in a cache of the thread
+/// and re-used by subsequent temporaries instead of being returned to the
+/// system. By default, each thread keeps up to 64 MiB. Setting the capacity
+/// to 0 disables the cache. Memory cached by the calling thread in excess
+/// of the new capacity is freed immediately, memory cached by other threads
+/// when these threads next free a temporary or exit.
+///
+/// \param size Number of bytes.
+///
+/// \sa scratchCapacity()
+///
+inline void
+setScratchCapacity
+(
+    const std::size_t size
+)
+{
+    marray_detail::scratchCapacitySetting() = size;
+    marray_detail::ScratchArena::local().trim(size);
+}
+
+/// Get the number of bytes each thread keeps for temporaries.
+///
+/// \sa setScratchCapacity()
+///
+inline std::size_t
+scratchCapacity()
+{
+    return marray_detail::scratchCapacitySetting();
+}
+
+/// Set the minimum size of Marrays whose memory is backed by huge pages.
+///
+/// On Linux, the memory of Marrays of at least this many bytes is advised
+/// to be backed by transparent huge pages (madvise with MADV_HUGEPAGE) 
+/// upon construction and resize. This reduces TLB misses in traversals of 
+/// multi-GB arrays. The advice has no effect if transparent huge pages are
+/// disabled in the kernel. By default, no advice is given. 
+///
+/// Independent of this setting, large Marrays are initialized in parallel,
+/// cf. setParallelThreshold(), with the same partition that is used by 
+/// subsequent operations, such that each page is placed on the NUMA node
+/// of the thread that processes it. This also holds for Marrays that are
+/// constructed with SkipInitialization.
+///
+/// \param size Minimum number of bytes.
+///
+/// \sa hugePageThreshold(), setNumberOfThreads()
+///
+inline void
+setHugePageThreshold
+(
+    const std::size_t size
+)
+{
+    marray_detail::hugePageThresholdSetting() = size;
+}
+
+/// Get the minimum size of Marrays whose memory is backed by huge pages.
+///
+/// \sa setHugePageThreshold()
+///
+inline std::size_t
+hugePageThreshold()
+{
+    return marray_detail::hugePageThresholdSetting();
+}
+
+// implementation of TraversalPlan
+
+/// Construct an empty plan.
+///
+template<std::size_t N>
+inline
+TraversalPlan<N>::TraversalPlan()
+:   dimension_(0),
+    size_(0),
+    shape_(),
+    strides_()
+{}
+
+/// Construct a plan for the joint traversal of N Views.
+///
+/// \param v N Views of equal shape. The loops are ordered by the strides
+/// of the first View such that it is traversed in the order of memory.
+///
+template<std::size_t N>
+template<class... T, bool... isConst, class... A>
+inline
+TraversalPlan<N>::TraversalPlan
+(
+    const View<T, isConst, A>&... v
+)
+:   dimension_(1),
+    size_(0),
+    shape_(),
+    strides_()
+{
+    static_assert(sizeof...(T) == N, "TraversalPlan<N> requires N Views.");
+    const std::size_t* shapes[] = {v.shapeBegin()...};
+    const std::size_t* stridesBegin[] = {v.stridesBegin()...};
+    const std::size_t dimensions[] = {v.dimension()...};
+    const std::size_t sizes[] = {v.size()...};
+    const std::size_t dimension = dimensions[0];
+    if(!MARRAY_NO_ARG_TEST) {
+        marray_detail::Assert(sizes[0] != 0);
+        for(std::size_t k=1; k<N; ++k) {
+            marray_detail::Assert(dimensions[k] == dimension);
+            for(std::size_t j=0; j<dimension; ++j) {
+                marray_detail::Assert(shapes[k][j] == shapes[0][j]);
+            }
+        }
+    }
+    size_ = sizes[0];
+    typedef marray_detail::SmallVector<std::size_t, MARRAY_INLINE_DIMENSION + 1> Buffer;
+    Buffer shape(dimension + 1);
+    Buffer strides[N];
+    std::size_t* s[N];
+    for(std::size_t k=0; k<N; ++k) {
+        strides[k] = Buffer(dimension + 1);
+        s[k] = strides[k].begin();
+    }
+    if(dimension == 0) { // a scalar
+        dimension_ = 0;
+    }
+    else {
+        std::copy(shapes[0], shapes[0] + dimension, shape.begin());
+        for(std::size_t k=0; k<N; ++k) {
+            std::copy(stridesBegin[k], stridesBegin[k] + dimension, s[k]);
+        }
+        marray_detail::orderDimensions(dimension, shape.begin(), s);
+        dimension_ = marray_detail::coalesceDimensions(dimension, shape.begin(), s);
+    }
+    if(dimension_ == 0) { // a single entry
+        dimension_ = 1;
+        shape[0] = 1;
+        for(std::size_t k=0; k<N; ++k) {
+            s[k][0] = 1;
+        }
+    }
+    shape_.assign(shape.begin(), shape.begin() + dimension_);
+    strides_.resize(N * dimension_);
+    for(std::size_t k=0; k<N; ++k) {
+        std::copy(s[k], s[k] + dimension_, strides_.begin() + k * dimension_);
+    }
+}
+
+/// Get the number of nested loops.
+///
+/// For a plan constructed from Views, this number is at least 1.
+///
+template<std::size_t N>
+inline const std::size_t
+TraversalPlan<N>::dimension() const
+{
+    return dimension_;
+}
+
+/// Get the number of entries traversed per View.
+///
+template<std::size_t N>
+inline const std::size_t
+TraversalPlan<N>::size() const
+{
+    return size_;
+}
+
+/// Get the number of iterations of a loop.
+///
+/// \param j Loop, 0 being the innermost loop.
+///
+template<std::size_t N>
+inline const std::size_t
+TraversalPlan<N>::shape
+(
+    const std::size_t j
+) const
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || j < dimension_);
+    return shape_[j];
+}
+
+/// Get the stride of a View in a loop.
+///
+/// \param k View.
+/// \param j Loop, 0 being the innermost loop.
+///
+template<std::size_t N>
+inline const std::size_t
+TraversalPlan<N>::strides
+(
+    const std::size_t k,
+    const std::size_t j
+) const
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || (k < N && j < dimension_));
+    return strides_[k * dimension_ + j];
+}
+
+/// Get the number of iterations of the innermost loop.
+///
+template<std::size_t N>
+inline const std::size_t
+TraversalPlan<N>::runLength() const
+{
+    return dimension_ == 0 ? 0 : shape_[0];
+}
+
+/// Check whether all Views are contiguous in the innermost loop.
+///
+template<std::size_t N>
+inline const bool
+TraversalPlan<N>::isContiguous() const
+{
+    for(std::size_t k=0; k<N; ++k) {
+        if(dimension_ == 0 || strides_[k * dimension_] != 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Execute the plan.
+///
+/// For every coordinate tuple, f is called with references to the 
+/// corresponding entries of all N Views, in the order of the Views.
+///
+/// \param f Functor.
+/// \param data N pointers to the first entries of Views with the shape
+/// and strides of the Views from which the plan was constructed, 
+/// e.g. &v(0).
+/// \return The functor after all calls.
+///
+template<std::size_t N>
+template<class Functor, class... P>
+inline Functor
+TraversalPlan<N>::execute
+(
+    Functor f,
+    P*... data
+) const
+{
+    static_assert(sizeof...(P) == N, "TraversalPlan<N>::execute requires N pointers.");
+    if(dimension_ != 0) {
+        const std::size_t* s[N];
+        for(std::size_t k=0; k<N; ++k) {
+            s[k] = &strides_[k * dimension_];
+        }
+        marray_detail::traverse(dimension_, &shape_[0], s, std::tuple<P*...>(data...), f,
+            typename marray_detail::MakeIndexSequence<N>::type());
+    }
+    return f;
+}
+
+// implementation of FixedRankView
+
+/// Empty constructor.
+///
+/// The empty constructor sets the data pointer to 0.
+///
+template<class T, std::size_t N, bool isConst>
+inline
+FixedRankView<T, N, isConst>::FixedRankView()
+:   data_(0),
+    shape_(),
+    strides_(),
+    size_(0),
+    coordinateOrder_(defaultOrder)
+{
+    shape_.fill(0);
+    strides_.fill(0);
+}
+
+/// Construct unstrided FixedRankView.
+///
+/// \param shape Shape.
+/// \param data Pointer to data.
+/// \param coordinateOrder Flag specifying the order of coordinates 
+/// based on which the strides are computed.
+///
+template<class T, std::size_t N, bool isConst>
+inline
+FixedRankView<T, N, isConst>::FixedRankView
+(
+    const shape_type& shape,
+    pointer data,
+    const CoordinateOrder& coordinateOrder
+)
+:   data_(data),
+    shape_(shape),
+    strides_(),
+    size_(std::accumulate(shape.begin(), shape.end(), static_cast<std::size_t>(1), 
+        std::multiplies<std::size_t>())),
+    coordinateOrder_(coordinateOrder)
+{
+    marray_detail::stridesFromShape(shape_.begin(), shape_.end(), strides_.begin(),
+        coordinateOrder);
+}
+
+/// Construct strided FixedRankView.
+///
+/// \param shape Shape.
+/// \param strides Strides.
+/// \param data Pointer to data.
+/// \param coordinateOrder Flag specifying the order of coordinates 
+/// which is used by a View converted from the FixedRankView.
+///
+template<class T, std::size_t N, bool isConst>
+inline
+FixedRankView<T, N, isConst>::FixedRankView
+(
+    const shape_type& shape,
+    const shape_type& strides,
+    pointer data,
+    const CoordinateOrder& coordinateOrder
+)
+:   data_(data),
+    shape_(shape),
+    strides_(strides),
+    size_(std::accumulate(shape.begin(), shape.end(), static_cast<std::size_t>(1), 
+        std::multiplies<std::size_t>())),
+    coordinateOrder_(coordinateOrder)
+{}
+
+/// Construct FixedRankView from a FixedRankView on mutable data.
+///
+/// \param in FixedRankView on mutable data.
+///
+template<class T, std::size_t N, bool isConst>
+inline
+FixedRankView<T, N, isConst>::FixedRankView
+(
+    const FixedRankView<T, N, false>& in
+)
+:   data_(in.data_),
+    shape_(in.shape_),
+    strides_(in.strides_),
+    size_(in.size_),
+    coordinateOrder_(in.coordinateOrder_)
+{}
+
+/// Construct FixedRankView from a View of dimension N.
+///
+/// The FixedRankView refers to the data under the View. A FixedRankView 
+/// on mutable data cannot be constructed from a View on constant data.
+///
+/// \param in View of dimension N.
+///
+template<class T, std::size_t N, bool isConst>
+template<bool isConstLocal, class A>
+inline
+FixedRankView<T, N, isConst>::FixedRankView
+(
+    const View<T, isConstLocal, A>& in
+)
+:   data_(in.data_),
+    shape_(),
+    strides_(),
+    size_(in.geometry_.size()),
+    coordinateOrder_(in.geometry_.coordinateOrder())
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || in.geometry_.dimension() == N);
+    std::copy(in.geometry_.shapeBegin(), in.geometry_.shapeEnd(), shape_.begin());
+    std::copy(in.geometry_.stridesBegin(), in.geometry_.stridesEnd(), strides_.begin());
+}
+
+/// Get the number of data items.
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t
+FixedRankView<T, N, isConst>::size() const
+{
+    return size_;
+}
+
+/// Get the shape in one dimension.
+///
+/// \param dimension Dimension
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t
+FixedRankView<T, N, isConst>::shape
+(
+    const std::size_t dimension
+) const
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || dimension < N);
+    return shape_[dimension];
+}
+
+/// Get a constant iterator to the beginning of the shape vector.
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t*
+FixedRankView<T, N, isConst>::shapeBegin() const
+{
+    return shape_.data();
+}
+
+/// Get a constant iterator to the end of the shape vector.
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t*
+FixedRankView<T, N, isConst>::shapeEnd() const
+{
+    return shape_.data() + N;
+}
+
+/// Get the strides in one dimension.
+///
+/// \param dimension Dimension
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t
+FixedRankView<T, N, isConst>::strides
+(
+    const std::size_t dimension
+) const
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || dimension < N);
+    return strides_[dimension];
+}
+
+/// Get a constant iterator to the beginning of the strides vector.
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t*
+FixedRankView<T, N, isConst>::stridesBegin() const
+{
+    return strides_.data();
+}
+
+/// Get a constant iterator to the end of the strides vector.
+///
+template<class T, std::size_t N, bool isConst>
+inline const std::size_t*
+FixedRankView<T, N, isConst>::stridesEnd() const
+{
+    return strides_.data() + N;
+}
+
+/// Get the coordinate order used by Views converted from the FixedRankView.
+///
+template<class T, std::size_t N, bool isConst>
+inline const CoordinateOrder&
+FixedRankView<T, N, isConst>::coordinateOrder() const
+{
+    return coordinateOrder_;
+}
+
+/// Reference data.
+///
+/// \param c N coordinates.
+///
+template<class T, std::size_t N, bool isConst>
+template<typename... Args>
+inline typename FixedRankView<T, N, isConst>::reference
+FixedRankView<T, N, isConst>::operator()
+(
+    const Args... c
+) const
+{
+    static_assert(sizeof...(Args) == N, "FixedRankView<T, N> requires N coordinates.");
+    if(!MARRAY_NO_DEBUG) {
+        const std::size_t coordinates[] = {static_cast<std::size_t>(c)...};
+        marray_detail::Assert(data_ != 0);
+        for(std::size_t j=0; j<N; ++j) {
+            marray_detail::Assert(coordinates[j] < shape_[j]);
+        }
+    }
+    return data_[marray_detail::fixedRankOffset(strides_.data(), c...)];
+}
+
+/// Get a sub-view.
+///
+/// \param base Coordinates of the first entry of the sub-view.
+/// \param shape Shape of the sub-view.
+/// \return Sub-view.
+///
+template<class T, std::size_t N, bool isConst>
+inline FixedRankView<T, N, isConst>
+FixedRankView<T, N, isConst>::view
+(
+    const shape_type& base,
+    const shape_type& shape
+) const
+{
+    std::size_t offset = 0;
+    for(std::size_t j=0; j<N; ++j) {
+        marray_detail::Assert(MARRAY_NO_ARG_TEST || base[j] + shape[j] <= shape_[j]);
+        offset += base[j] * strides_[j];
+    }
+    return FixedRankView<T, N, isConst>(shape, strides_, data_ + offset, coordinateOrder_);
+}
+
+/// Get a FixedRankView of dimension N-1 where one coordinate is bound to a value.
+///
+/// \param dimension Dimension of the coordinate to bind.
+/// \param value Value to assign to the coordinate.
+/// \return The bound view.
+///
+template<class T, std::size_t N, bool isConst>
+inline FixedRankView<T, N - 1, isConst>
+FixedRankView<T, N, isConst>::boundView
+(
+    const std::size_t dimension,
+    const std::size_t value
+) const
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || (dimension < N && value < shape_[dimension]));
+    typename FixedRankView<T, N - 1, isConst>::shape_type shape;
+    typename FixedRankView<T, N - 1, isConst>::shape_type strides;
+    for(std::size_t j=0, k=0; j<N; ++j) {
+        if(j != dimension) {
+            shape[k] = shape_[j];
+            strides[k] = strides_[j];
+            ++k;
+        }
+    }
+    return FixedRankView<T, N - 1, isConst>(shape, strides, 
+        data_ + strides_[dimension] * value, coordinateOrder_);
+}
+
+/// Get a FixedRankView in which two dimensions are exchanged.
+///
+/// \param j Dimension.
+/// \param k Dimension.
+/// \return Transposed view.
+///
+template<class T, std::size_t N, bool isConst>
+inline FixedRankView<T, N, isConst>
+FixedRankView<T, N, isConst>::transposedView
+(
+    const std::size_t j,
+    const std::size_t k
+) const
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || (j < N && k < N));
+    FixedRankView<T, N, isConst> out = *this;
+    std::swap(out.shape_[j], out.shape_[k]);
+    std::swap(out.strides_[j], out.strides_[k]);
+    return out;
+}
+
+/// Get a View on the same data.
+///
+/// The View can be used wherever a View of runtime dimension is required,
+/// e.g. in expressions.
+///
+template<class T, std::size_t N, bool isConst>
+inline View<T, isConst>
+FixedRankView<T, N, isConst>::asView() const
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || data_ != 0);
+    return View<T, isConst>(shape_.begin(), shape_.end(), strides_.begin(), 
+        data_, coordinateOrder_);
+}
+
+/// Conversion to a View on the same data.
+///
+template<class T, std::size_t N, bool isConst>
+template<bool isConstLocal, class A>
+inline
+FixedRankView<T, N, isConst>::operator View<T, isConstLocal, A>() const
+{
+    static_assert(isConstLocal || !isConst, 
+        "A FixedRankView on constant data cannot be converted to a View on mutable data.");
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || data_ != 0);
+    return View<T, isConstLocal, A>(shape_.begin(), shape_.end(), strides_.begin(), 
+        data_, coordinateOrder_);
+}
+
+// implementation of FixedRankMarray
+
+/// Empty constructor.
+///
+/// \param allocator Allocator.
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const allocator_type& allocator
+)
+:   base(),
+    dataAllocator_(allocator)
+{}
+
+/// Construct FixedRankMarray with initialization.
+///
+/// \param shape Shape.
+/// \param value Value with which all entries are initialized.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+/// \param allocator Allocator.
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const shape_type& shape,
+    const T& value,
+    const CoordinateOrder& coordinateOrder,
+    const allocator_type& allocator
+)
+:   base(),
+    dataAllocator_(allocator)
+{
+    allocate(shape.begin(), coordinateOrder);
+    marray_detail::fillContiguous(this->data_, this->size_, value);
+}
+
+/// Construct FixedRankMarray without initialization.
+///
+/// \param is Flag to be set to SkipInitialization.
+/// \param shape Shape.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+/// \param allocator Allocator.
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const InitializationSkipping& is,
+    const shape_type& shape,
+    const CoordinateOrder& coordinateOrder,
+    const allocator_type& allocator
+)
+:   base(),
+    dataAllocator_(allocator)
+{
+    allocate(shape.begin(), coordinateOrder);
+}
+
+/// Copy from a FixedRankMarray.
+///
+/// \param in FixedRankMarray (source).
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const FixedRankMarray<T, N, A>& in
+)
+:   base(),
+    dataAllocator_(in.dataAllocator_)
+{
+    if(in.data_ != 0) {
+        allocate(in.shape_.begin(), in.coordinateOrder_);
+        marray_detail::copyContiguous(this->data_, in.data_, in.size_, sizeof(T));
+    }
+}
+
+/// Move constructor.
+///
+/// The data of 'in' is taken over without copying, and 'in' is left
+/// un-initialized.
+///
+/// \param in FixedRankMarray (source).
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    FixedRankMarray<T, N, A>&& in
+) noexcept
+:   base(in),
+    dataAllocator_(in.dataAllocator_)
+{
+    static_cast<base&>(in) = base();
+}
+
+/// Copy from a View of dimension N.
+///
+/// \param in View (source).
+///
+template<class T, std::size_t N, class A>
+template<class TLocal, bool isConstLocal, class ALocal>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const View<TLocal, isConstLocal, ALocal>& in
+)
+:   base(),
+    dataAllocator_()
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || in.dimension() == N);
+    allocate(in.shapeBegin(), in.coordinateOrder());
+    View<T> v = this->asView();
+    v = in;
+}
+
+/// Construct FixedRankMarray from a ViewExpression of dimension N.
+///
+/// \param expression ViewExpression.
+/// \param allocator Allocator.
+///
+template<class T, std::size_t N, class A>
+template<class E, class Te>
+inline
+FixedRankMarray<T, N, A>::FixedRankMarray
+(
+    const ViewExpression<E, Te>& expression,
+    const allocator_type& allocator
+)
+:   base(),
+    dataAllocator_(allocator)
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || expression.dimension() == N);
+    allocate(expression.shapeBegin(), expression.coordinateOrder());
+    View<T> v = this->asView();
+    v = expression;
+}
+
+/// Destructor.
+///
+template<class T, std::size_t N, class A>
+inline
+FixedRankMarray<T, N, A>::~FixedRankMarray()
+{
+    deallocate();
+}
+
+/// Assignment.
+///
+/// \param value Value.
+///
+/// All entries are set to value.
+///
+template<class T, std::size_t N, class A>
+inline FixedRankMarray<T, N, A>&
+FixedRankMarray<T, N, A>::operator=
+(
+    const T& value
+)
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || this->data_ != 0);
+    marray_detail::fillContiguous(this->data_, this->size_, value);
+    return *this;
+}
+
+/// Assignment.
+///
+/// Memory is re-allocated only if the sizes differ.
+///
+/// \param in FixedRankMarray (source).
+///
+template<class T, std::size_t N, class A>
+inline FixedRankMarray<T, N, A>&
+FixedRankMarray<T, N, A>::operator=
+(
+    const FixedRankMarray<T, N, A>& in
+)
+{
+    if(this != &in) { // no self-assignment
+        if(in.data_ == 0) {
+            deallocate();
+        }
+        else {
+            if(this->size_ != in.size_) {
+                deallocate();
+                allocate(in.shape_.begin(), in.coordinateOrder_);
+            }
+            else {
+                static_cast<base&>(*this) = base(in.shape_, this->data_, in.coordinateOrder_);
+            }
+            marray_detail::copyContiguous(this->data_, in.data_, in.size_, sizeof(T));
+        }
+    }
+    return *this;
+}
 
-template<class A>
-inline 
-Geometry<A>::Geometry
+/// Move assignment.
+///
+/// The memory allocated for *this is freed, and the data of 'in' is 
+/// taken over without copying. 'in' is left un-initialized.
+///
+/// \param in FixedRankMarray (source).
+///
+template<class T, std::size_t N, class A>
+inline FixedRankMarray<T, N, A>&
+FixedRankMarray<T, N, A>::operator=
 (
-    const typename Geometry<A>::allocator_type& allocator
-) 
-: allocator_(allocator),
-  shape_(0), 
-  shapeStrides_(0), 
-  strides_(0), 
-  dimension_(0),
-  size_(0), 
-  coordinateOrder_(defaultOrder), 
-  isSimple_(true)
+    FixedRankMarray<T, N, A>&& in
+) noexcept
 {
+    if(this != &in) { // no self-assignment
+        deallocate();
+        static_cast<base&>(*this) = in;
+        dataAllocator_ = in.dataAllocator_;
+        static_cast<base&>(in) = base();
+    }
+    return *this;
 }
 
-template<class A>
-inline 
-Geometry<A>::Geometry
+/// Assignment from a ViewExpression of dimension N.
+///
+/// Memory is re-allocated only if the shapes differ. The expression may 
+/// refer to the FixedRankMarray.
+///
+/// \param expression ViewExpression.
+///
+template<class T, std::size_t N, class A>
+template<class E, class Te>
+inline FixedRankMarray<T, N, A>&
+FixedRankMarray<T, N, A>::operator=
 (
-    const Geometry<A>& g
+    const ViewExpression<E, Te>& expression
 )
-: allocator_(g.allocator_),
-  shape_(g.dimension_==0 ? 0 : allocator_.allocate(g.dimension_*3)), 
-  shapeStrides_(shape_ + g.dimension_), 
-  strides_(shapeStrides_ + g.dimension_), 
-  dimension_(g.dimension_),
-  size_(g.size_), 
-  coordinateOrder_(g.coordinateOrder_), 
-  isSimple_(g.isSimple_)
 {
-    /*
-    for(std::size_t j=0; j<dimension_; ++j) {
-        shape_[j] = g.shape_[j];
-        shapeStrides_[j] = g.shapeStrides_[j];
-        strides_[j] = g.strides_[j];
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || expression.dimension() == N);
+    if(this->data_ != 0 
+    && std::equal(this->shape_.begin(), this->shape_.end(), expression.shapeBegin())) {
+        View<T> v = this->asView();
+        v = expression; // handles overlap
+    }
+    else {
+        FixedRankMarray<T, N, A> m(expression, dataAllocator_);
+        (*this) = std::move(m);
     }
-    */
-    memcpy(shape_, g.shape_, (dimension_*3)*sizeof(std::size_t));
+    return *this;
 }
 
-template<class A>
-inline 
-Geometry<A>::Geometry
+/// Resize with initialization.
+///
+/// The entries are set to value.
+///
+/// \param shape Shape.
+/// \param value Value with which all entries are initialized.
+///
+template<class T, std::size_t N, class A>
+inline void
+FixedRankMarray<T, N, A>::resize
 (
-    const std::size_t dimension,
-    const CoordinateOrder& order,
-    const std::size_t size,
-    const bool isSimple,
-    const typename Geometry<A>::allocator_type& allocator
+    const shape_type& shape,
+    const T& value
 )
-: allocator_(allocator),
-  shape_(allocator_.allocate(dimension*3)), 
-  shapeStrides_(shape_+dimension),
-  strides_(shapeStrides_+dimension), 
-  dimension_(dimension),
-  size_(size),
-  coordinateOrder_(order),
-  isSimple_(isSimple)
 {
+    resize(SkipInitialization, shape);
+    marray_detail::fillContiguous(this->data_, this->size_, value);
 }
 
-template<class A>
+/// Resize without initialization.
+///
+/// Memory is re-allocated only if the sizes differ. The coordinate 
+/// order is maintained, the entries are not.
+///
+/// \param is Flag to be set to SkipInitialization.
+/// \param shape Shape.
+///
+template<class T, std::size_t N, class A>
+inline void
+FixedRankMarray<T, N, A>::resize
+(
+    const InitializationSkipping& is,
+    const shape_type& shape
+)
+{
+    const std::size_t size = std::accumulate(shape.begin(), shape.end(), 
+        static_cast<std::size_t>(1), std::multiplies<std::size_t>());
+    if(this->data_ != 0 && size == this->size_) {
+        static_cast<base&>(*this) = base(shape, this->data_, this->coordinateOrder_);
+    }
+    else {
+        const CoordinateOrder coordinateOrder = this->coordinateOrder_;
+        deallocate();
+        allocate(shape.begin(), coordinateOrder);
+    }
+}
+
+// allocates memory for an (un-initialized) FixedRankMarray of the given shape
+template<class T, std::size_t N, class A>
 template<class ShapeIterator>
-inline 
-Geometry<A>::Geometry
+inline void
+FixedRankMarray<T, N, A>::allocate
 (
-    ShapeIterator begin, 
-    ShapeIterator end,
-    const CoordinateOrder& externalCoordinateOrder,
-    const CoordinateOrder& internalCoordinateOrder,
-    const typename Geometry<A>::allocator_type& allocator
+    ShapeIterator begin,
+    const CoordinateOrder& coordinateOrder
 )
-: allocator_(allocator),
-  shape_(allocator_.allocate(std::distance(begin, end) * 3)), 
-  shapeStrides_(shape_ + std::distance(begin, end)),
-  strides_(shapeStrides_ + std::distance(begin, end)), 
-  dimension_(std::distance(begin, end)),
-  size_(1),
-  coordinateOrder_(internalCoordinateOrder),
-  isSimple_(true)
 {
-    if(dimension_ != 0) { // if the array is not a scalar
-        isSimple_ = (externalCoordinateOrder == internalCoordinateOrder);
-        for(std::size_t j=0; j<dimension(); ++j, ++begin) {
-            const std::size_t s = static_cast<std::size_t>(*begin);
-            shape(j) = s;
-            size() *= s;
-        }
-        stridesFromShape(shapeBegin(), shapeEnd(), stridesBegin(), 
-            externalCoordinateOrder);
-        stridesFromShape(shapeBegin(), shapeEnd(), shapeStridesBegin(), 
-            internalCoordinateOrder);
+    shape_type shape;
+    std::copy(begin, begin + N, shape.begin());
+    const std::size_t size = std::accumulate(shape.begin(), shape.end(), 
+        static_cast<std::size_t>(1), std::multiplies<std::size_t>());
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || size != 0);
+    static_cast<base&>(*this) = base(shape, dataAllocator_.allocate(size), coordinateOrder);
+}
+
+// frees the memory and leaves the FixedRankMarray un-initialized
+template<class T, std::size_t N, class A>
+inline void
+FixedRankMarray<T, N, A>::deallocate()
+{
+    if(this->data_ != 0) {
+        dataAllocator_.deallocate(this->data_, this->size_);
+        static_cast<base&>(*this) = base();
     }
 }
 
-template<class A>
-template<class ShapeIterator, class StrideIterator>
+// implementation of FixedShapeMarray
+
+template<class T, std::size_t... S>
+constexpr std::size_t FixedShapeMarray<T, S...>::fixedShape_[sizeof...(S)];
+
+/// Construct FixedShapeMarray with initialization.
+///
+/// \param value Value with which all entries are initialized.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+///
+template<class T, std::size_t... S>
 inline
-Geometry<A>::Geometry
+FixedShapeMarray<T, S...>::FixedShapeMarray
 (
-    ShapeIterator begin, 
-    ShapeIterator end,
-    StrideIterator it,
-    const CoordinateOrder& internalCoordinateOrder,
-    const typename Geometry<A>::allocator_type& allocator
+    const T& value,
+    const CoordinateOrder& coordinateOrder
 )
-: allocator_(allocator),
-  shape_(allocator_.allocate(std::distance(begin, end) * 3)), 
-  shapeStrides_(shape_ + std::distance(begin, end)),
-  strides_(shapeStrides_ + std::distance(begin, end)), 
-  dimension_(std::distance(begin, end)),
-  size_(1),
-  coordinateOrder_(internalCoordinateOrder),
-  isSimple_(true)
+:   base(fixedShape_, fixedShape_ + sizeof...(S), entries_, coordinateOrder, 
+        coordinateOrder)
 {
-    if(dimension() != 0) {
-        for(std::size_t j=0; j<dimension(); ++j, ++begin, ++it) {
-            const std::size_t s = static_cast<std::size_t>(*begin);
-            shape(j) = s;
-            size() *= s;
-            strides(j) = *it;
-        }
-        stridesFromShape(shapeBegin(), shapeEnd(), shapeStridesBegin(), 
-            internalCoordinateOrder);
-        updateSimplicity();
-    }
+    std::fill(entries_, entries_ + marray_detail::ShapeSize<S...>::value, value);
 }
 
-template<class A>
-inline 
-Geometry<A>::~Geometry()
+/// Construct FixedShapeMarray without initialization.
+///
+/// \param is Flag to be set to SkipInitialization.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+///
+template<class T, std::size_t... S>
+inline
+FixedShapeMarray<T, S...>::FixedShapeMarray
+(
+    const InitializationSkipping& is,
+    const CoordinateOrder& coordinateOrder
+)
+:   base(fixedShape_, fixedShape_ + sizeof...(S), entries_, coordinateOrder, 
+        coordinateOrder)
+{}
+
+/// Copy from a FixedShapeMarray.
+///
+/// \param in FixedShapeMarray (source).
+///
+template<class T, std::size_t... S>
+inline
+FixedShapeMarray<T, S...>::FixedShapeMarray
+(
+    const FixedShapeMarray<T, S...>& in
+)
+:   base(fixedShape_, fixedShape_ + sizeof...(S), entries_, in.coordinateOrder(), 
+        in.coordinateOrder())
 {
-    allocator_.deallocate(shape_, dimension_*3); 
+    base::operator=(in);
 }
 
-template<class A>
-inline Geometry<A>& 
-Geometry<A>::operator=
+/// Copy from a View of shape S...
+///
+/// \param in View (source).
+///
+template<class T, std::size_t... S>
+template<class TLocal, bool isConstLocal, class ALocal>
+inline
+FixedShapeMarray<T, S...>::FixedShapeMarray
 (
-    const Geometry<A>& g
+    const View<TLocal, isConstLocal, ALocal>& in
 )
+:   base(fixedShape_, fixedShape_ + sizeof...(S), entries_, in.coordinateOrder(), 
+        in.coordinateOrder())
 {
-    if(&g != this) { // no self-assignment
-        if(g.dimension_ != dimension_) {
-            allocator_.deallocate(shape_, dimension_*3);
-            dimension_ = g.dimension_;
-            shape_ = allocator_.allocate(dimension_*3);
-            shapeStrides_ = shape_+dimension_;
-            strides_ = shapeStrides_+dimension_;
-            dimension_ = g.dimension_;
-        }
-        /*
-        for(std::size_t j=0; j<dimension_; ++j) {
-            shape_[j] = g.shape_[j];
-            shapeStrides_[j] = g.shapeStrides_[j];
-            strides_[j] = g.strides_[j];
-        }
-        */
-        memcpy(shape_, g.shape_, (dimension_*3)*sizeof(std::size_t));
-        size_ = g.size_;
-        coordinateOrder_ = g.coordinateOrder_;
-        isSimple_ = g.isSimple_;
-    }
-    return *this;
+    base::operator=(in);
 }
 
-template<class A>
-inline void 
-Geometry<A>::resize
+/// Construct FixedShapeMarray from a ViewExpression of shape S...
+///
+/// \param expression ViewExpression.
+///
+template<class T, std::size_t... S>
+template<class E, class Te>
+inline
+FixedShapeMarray<T, S...>::FixedShapeMarray
 (
-    const std::size_t dimension
+    const ViewExpression<E, Te>& expression
 )
+:   base(fixedShape_, fixedShape_ + sizeof...(S), entries_, expression.coordinateOrder(), 
+        expression.coordinateOrder())
 {
-    if(dimension != dimension_) {
-        std::size_t* newShape = allocator_.allocate(dimension*3);
-        std::size_t* newShapeStrides = newShape + dimension;
-        std::size_t* newStrides = newShapeStrides + dimension; 
-        for(std::size_t j=0; j<( (dimension < dimension_) ? dimension : dimension_); ++j) {
-            // save existing entries
-            newShape[j] = shape(j);
-            newShapeStrides[j] = shapeStrides(j);
-            newStrides[j] = strides(j);
-        }
-        allocator_.deallocate(shape_, dimension_*3);
-        shape_ = newShape;
-        shapeStrides_ = newShapeStrides;
-        strides_ = newStrides;
-        dimension_ = dimension;
-    }
+    base::operator=(expression);
 }
 
-template<class A>
-inline const std::size_t 
-Geometry<A>::dimension() const
+/// Assignment.
+///
+/// The entries of 'in' are copied.
+///
+/// \param in FixedShapeMarray (source).
+///
+template<class T, std::size_t... S>
+inline FixedShapeMarray<T, S...>&
+FixedShapeMarray<T, S...>::operator=
+(
+    const FixedShapeMarray<T, S...>& in
+)
 {
-    return dimension_; 
+    base::operator=(in);
+    return *this;
 }
 
-template<class A>
-inline const std::size_t 
-Geometry<A>::shape(const std::size_t j) const
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return shape_[j]; 
+// implementation of AlignedAllocator
+
+template<class T, std::size_t ALIGNMENT>
+inline
+AlignedAllocator<T, ALIGNMENT>::AlignedAllocator()
+{}
+
+template<class T, std::size_t ALIGNMENT>
+template<class U>
+inline
+AlignedAllocator<T, ALIGNMENT>::AlignedAllocator
+(
+    const AlignedAllocator<U, ALIGNMENT>&
+)
+{}
+
+/// Allocate memory for n objects of type T, aligned at ALIGNMENT bytes.
+///
+/// The address of the memory returned by operator new is stored 
+/// immediately before the aligned memory.
+///
+/// \param n Number of objects.
+///
+template<class T, std::size_t ALIGNMENT>
+inline typename AlignedAllocator<T, ALIGNMENT>::pointer
+AlignedAllocator<T, ALIGNMENT>::allocate
+(
+    const size_type n,
+    const void*
+)
+{
+    if(n == 0) {
+        return 0;
+    }
+    if(n > max_size()) {
+        throw std::bad_alloc();
+    }
+    void* memory = ::operator new(n * sizeof(T) + ALIGNMENT + sizeof(void*));
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(memory) + sizeof(void*);
+    address = (address + ALIGNMENT - 1) & ~static_cast<std::uintptr_t>(ALIGNMENT - 1);
+    reinterpret_cast<void**>(address)[-1] = memory;
+    return reinterpret_cast<pointer>(address);
 }
 
-template<class A>
-inline std::size_t& 
-Geometry<A>::shape(const std::size_t j)
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return shape_[j]; 
+/// Free memory allocated by allocate().
+///
+/// \param p Pointer to the memory.
+/// \param n Number of objects.
+///
+template<class T, std::size_t ALIGNMENT>
+inline void
+AlignedAllocator<T, ALIGNMENT>::deallocate
+(
+    pointer p,
+    const size_type n
+)
+{
+    if(p != 0) {
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
 }
 
-template<class A>
-inline const std::size_t 
-Geometry<A>::shapeStrides
-(
-    const std::size_t j
-) const
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return shapeStrides_[j]; 
+template<class T, std::size_t ALIGNMENT>
+inline typename AlignedAllocator<T, ALIGNMENT>::size_type
+AlignedAllocator<T, ALIGNMENT>::max_size() const
+{
+    return (std::numeric_limits<size_type>::max() - ALIGNMENT - sizeof(void*)) / sizeof(T);
 }
 
-template<class A>
-inline std::size_t& 
-Geometry<A>::shapeStrides
+template<class T1, class T2, std::size_t ALIGNMENT>
+inline bool
+operator==
 (
-    const std::size_t j
+    const AlignedAllocator<T1, ALIGNMENT>&,
+    const AlignedAllocator<T2, ALIGNMENT>&
 )
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return shapeStrides_[j]; 
+{
+    return true;
 }
 
-template<class A>
-inline const std::size_t 
-Geometry<A>::strides
+template<class T1, class T2, std::size_t ALIGNMENT>
+inline bool
+operator!=
 (
-    const std::size_t j
-) const
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return strides_[j]; 
+    const AlignedAllocator<T1, ALIGNMENT>&,
+    const AlignedAllocator<T2, ALIGNMENT>&
+)
+{
+    return false;
 }
 
-template<class A>
-inline std::size_t& 
-Geometry<A>::strides
+// implementation of PaddedMarray
+
+/// Empty constructor.
+///
+template<class T, std::size_t ALIGNMENT>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray()
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{}
+
+/// Construct PaddedMarray with initialization.
+///
+/// \param begin Iterator to the beginning of a sequence that determines
+/// the shape.
+/// \param end Iterator to the end of that sequence.
+/// \param value Value with which all entries, including the padding, are
+/// initialized.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+///
+template<class T, std::size_t ALIGNMENT>
+template<class ShapeIterator>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
 (
-    const std::size_t j
+    ShapeIterator begin,
+    ShapeIterator end,
+    const T& value,
+    const CoordinateOrder& coordinateOrder
 )
-{ 
-    Assert(MARRAY_NO_DEBUG || j<dimension_); 
-    return strides_[j]; 
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{
+    allocate(begin, end, coordinateOrder);
+    marray_detail::fillContiguous(this->data_, allocatedSize_, value);
 }
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::shapeBegin() const
-{ 
-    return shape_; 
+/// Construct PaddedMarray without initialization.
+///
+/// \param is Flag to be set to SkipInitialization.
+/// \param begin Iterator to the beginning of a sequence that determines
+/// the shape.
+/// \param end Iterator to the end of that sequence.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+///
+template<class T, std::size_t ALIGNMENT>
+template<class ShapeIterator>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    const InitializationSkipping& is,
+    ShapeIterator begin,
+    ShapeIterator end,
+    const CoordinateOrder& coordinateOrder
+)
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{
+    allocate(begin, end, coordinateOrder);
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::shapeBegin()
-{ 
-    return shape_; 
-}
+/// Construct PaddedMarray with initialization.
+///
+/// \param shape Shape given as initializer list.
+/// \param value Value with which all entries, including the padding, are
+/// initialized.
+/// \param coordinateOrder Flag specifying whether FirstMajorOrder or
+/// LastMajorOrder is to be used.
+///
+template<class T, std::size_t ALIGNMENT>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    std::initializer_list<std::size_t> shape,
+    const T& value,
+    const CoordinateOrder& coordinateOrder
+)
+:   PaddedMarray(shape.begin(), shape.end(), value, coordinateOrder)
+{}
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::shapeEnd() const 
-{ 
-    return shape_ + dimension_; 
+/// Copy from a PaddedMarray.
+///
+/// \param in PaddedMarray (source).
+///
+template<class T, std::size_t ALIGNMENT>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    const PaddedMarray<T, ALIGNMENT>& in
+)
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{
+    if(in.data_ != 0) {
+        allocate(in.shapeBegin(), in.shapeEnd(), in.coordinateOrder());
+        marray_detail::copyContiguous(this->data_, in.data_, allocatedSize_, sizeof(T));
+    }
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::shapeEnd() 
-{ 
-    return shape_ + dimension_; 
+/// Move constructor.
+///
+/// The data of 'in' is taken over without copying, and 'in' is left
+/// un-initialized.
+///
+/// \param in PaddedMarray (source).
+///
+template<class T, std::size_t ALIGNMENT>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    PaddedMarray<T, ALIGNMENT>&& in
+) noexcept
+:   base(static_cast<base&&>(in)),
+    allocatedSize_(in.allocatedSize_),
+    dataAllocator_()
+{
+    in.allocatedSize_ = 0;
 }
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::shapeStridesBegin() const 
-{ 
-    return shapeStrides_; 
+/// Copy from a View.
+///
+/// \param in View (source).
+///
+template<class T, std::size_t ALIGNMENT>
+template<class TLocal, bool isConstLocal, class ALocal>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    const View<TLocal, isConstLocal, ALocal>& in
+)
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{
+    allocate(in.shapeBegin(), in.shapeEnd(), in.coordinateOrder());
+    base::operator=(in);
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::shapeStridesBegin() 
-{ 
-    return shapeStrides_; 
+/// Construct PaddedMarray from a ViewExpression.
+///
+/// \param expression ViewExpression.
+///
+template<class T, std::size_t ALIGNMENT>
+template<class E, class Te>
+inline
+PaddedMarray<T, ALIGNMENT>::PaddedMarray
+(
+    const ViewExpression<E, Te>& expression
+)
+:   base(),
+    allocatedSize_(0),
+    dataAllocator_()
+{
+    allocate(expression.shapeBegin(), expression.shapeEnd(), expression.coordinateOrder());
+    base::operator=(expression);
 }
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::shapeStridesEnd() const 
-{ 
-    return shapeStrides_ + dimension_; 
+/// Destructor.
+///
+template<class T, std::size_t ALIGNMENT>
+inline
+PaddedMarray<T, ALIGNMENT>::~PaddedMarray()
+{
+    deallocate();
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::shapeStridesEnd() 
-{ 
-    return shapeStrides_ + dimension_; 
+/// Assignment.
+///
+/// Memory is re-allocated only if the shapes differ.
+///
+/// \param in PaddedMarray (source).
+///
+template<class T, std::size_t ALIGNMENT>
+inline PaddedMarray<T, ALIGNMENT>&
+PaddedMarray<T, ALIGNMENT>::operator=
+(
+    const PaddedMarray<T, ALIGNMENT>& in
+)
+{
+    if(this != &in) { // no self-assignment
+        if(in.data_ == 0) {
+            deallocate();
+        }
+        else {
+            reallocate(in.shapeBegin(), in.shapeEnd(), in.coordinateOrder());
+            marray_detail::copyContiguous(this->data_, in.data_, allocatedSize_, sizeof(T));
+        }
+    }
+    return *this;
 }
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::stridesBegin() const 
-{ 
-    return strides_; 
+/// Move assignment.
+///
+/// The memory allocated for *this is freed, and the data of 'in' is 
+/// taken over without copying. 'in' is left un-initialized.
+///
+/// \param in PaddedMarray (source).
+///
+template<class T, std::size_t ALIGNMENT>
+inline PaddedMarray<T, ALIGNMENT>&
+PaddedMarray<T, ALIGNMENT>::operator=
+(
+    PaddedMarray<T, ALIGNMENT>&& in
+) noexcept
+{
+    if(this != &in) { // no self-assignment
+        deallocate();
+        base::operator=(static_cast<base&&>(in));
+        allocatedSize_ = in.allocatedSize_;
+        in.allocatedSize_ = 0;
+    }
+    return *this;
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::stridesBegin() 
-{ 
-    return strides_; 
+/// Assignment.
+///
+/// \param value Value.
+///
+/// All entries are set to value. The padding is left unchanged.
+///
+template<class T, std::size_t ALIGNMENT>
+inline PaddedMarray<T, ALIGNMENT>&
+PaddedMarray<T, ALIGNMENT>::operator=
+(
+    const T& value
+)
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || this->data_ != 0);
+    base::operator=(value);
+    return *this;
 }
 
-template<class A>
-inline const std::size_t* 
-Geometry<A>::stridesEnd() const 
-{ 
-    return strides_ + dimension_; 
+/// Assignment from a View.
+///
+/// Padded memory is (re-)allocated if the PaddedMarray is un-initialized
+/// or if its shape differs from that of the View.
+///
+/// \param in View (source).
+///
+template<class T, std::size_t ALIGNMENT>
+template<class TLocal, bool isConstLocal, class ALocal>
+inline PaddedMarray<T, ALIGNMENT>&
+PaddedMarray<T, ALIGNMENT>::operator=
+(
+    const View<TLocal, isConstLocal, ALocal>& in
+)
+{
+    if(!MARRAY_NO_ARG_TEST) {
+        in.testInvariant();
+    }
+    const bool sameShape = this->data_ != 0 
+        && in.dimension() == this->dimension()
+        && std::equal(this->shapeBegin(), this->shapeEnd(), in.shapeBegin());
+    if(in.data_ == 0) {
+        deallocate();
+    }
+    else if(sameShape) {
+        base::operator=(in);
+    }
+    else if(this->data_ != 0 && this->overlaps(in)) {
+        PaddedMarray<T, ALIGNMENT> m(in); // temporary copy
+        (*this) = std::move(m);
+    }
+    else {
+        reallocate(in.shapeBegin(), in.shapeEnd(), in.coordinateOrder());
+        base::operator=(in);
+    }
+    return *this;
 }
 
-template<class A>
-inline std::size_t* 
-Geometry<A>::stridesEnd() 
-{ 
-    return strides_ + dimension_; 
+/// Assignment from a ViewExpression.
+///
+/// Padded memory is (re-)allocated if the PaddedMarray is un-initialized
+/// or if its shape differs from that of the expression.
+///
+/// \param expression ViewExpression.
+///
+template<class T, std::size_t ALIGNMENT>
+template<class E, class Te>
+inline PaddedMarray<T, ALIGNMENT>&
+PaddedMarray<T, ALIGNMENT>::operator=
+(
+    const ViewExpression<E, Te>& expression
+)
+{
+    const bool sameShape = this->data_ != 0 
+        && expression.dimension() == this->dimension()
+        && std::equal(this->shapeBegin(), this->shapeEnd(), expression.shapeBegin());
+    if(sameShape) {
+        base::operator=(expression);
+    }
+    else if(this->data_ != 0 && expression.overlaps(*this)) {
+        PaddedMarray<T, ALIGNMENT> m(expression); // temporary copy
+        (*this) = std::move(m);
+    }
+    else {
+        reallocate(expression.shapeBegin(), expression.shapeEnd(), expression.coordinateOrder());
+        base::operator=(expression);
+    }
+    return *this;
 }
 
-template<class A>
-inline const std::size_t 
-Geometry<A>::size() const
-{ 
-    return size_; 
+/// Get the distance in memory between consecutive rows, i.e. the padded
+/// shape in the fastest varying dimension.
+///
+template<class T, std::size_t ALIGNMENT>
+inline const std::size_t
+PaddedMarray<T, ALIGNMENT>::pitch() const
+{
+    marray_detail::Assert(MARRAY_NO_DEBUG || this->data_ != 0);
+    if(this->dimension() < 2) {
+        return this->size();
+    }
+    else if(this->coordinateOrder() == FirstMajorOrder) {
+        return this->strides(this->dimension() - 2);
+    }
+    else {
+        return this->strides(1);
+    }
 }
 
-template<class A>
-inline std::size_t& 
-Geometry<A>::size()
-{ 
-    return size_; 
+// allocates padded memory for an (un-initialized) PaddedMarray
+template<class T, std::size_t ALIGNMENT>
+template<class ShapeIterator>
+inline void
+PaddedMarray<T, ALIGNMENT>::allocate
+(
+    ShapeIterator begin,
+    ShapeIterator end,
+    const CoordinateOrder& coordinateOrder
+)
+{
+    // entries per ALIGNMENT bytes
+    const std::size_t granularity = (ALIGNMENT % sizeof(T) == 0) ? ALIGNMENT / sizeof(T) : 1;
+    const std::size_t dimension = std::distance(begin, end);
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || dimension != 0);
+    std::vector<std::size_t> shape(begin, end);
+    std::vector<std::size_t> strides(dimension);
+    const std::size_t fastest = (coordinateOrder == FirstMajorOrder) ? dimension - 1 : 0;
+    const std::size_t pitch = (shape[fastest] + granularity - 1) / granularity * granularity;
+    std::size_t stride = 1;
+    for(std::size_t k=0; k<dimension; ++k) {
+        const std::size_t j = (coordinateOrder == FirstMajorOrder) ? dimension - 1 - k : k;
+        marray_detail::Assert(MARRAY_NO_ARG_TEST || shape[j] != 0);
+        strides[j] = stride;
+        stride *= (j == fastest) ? pitch : shape[j];
+    }
+    allocatedSize_ = stride;
+    base::assign(shape.begin(), shape.end(), strides.begin(), 
+        dataAllocator_.allocate(allocatedSize_), coordinateOrder);
 }
 
-template<class A>
-inline const CoordinateOrder& 
-Geometry<A>::coordinateOrder() const
-{ 
-    return coordinateOrder_; 
+// allocates padded memory for the given shape and coordinate order unless
+// the PaddedMarray already has this geometry
+template<class T, std::size_t ALIGNMENT>
+template<class ShapeIterator>
+inline void
+PaddedMarray<T, ALIGNMENT>::reallocate
+(
+    ShapeIterator begin,
+    ShapeIterator end,
+    const CoordinateOrder& coordinateOrder
+)
+{
+    if(this->data_ == 0 
+    || this->dimension() != static_cast<std::size_t>(std::distance(begin, end))
+    || !std::equal(begin, end, this->shapeBegin())
+    || this->coordinateOrder() != coordinateOrder) {
+        deallocate();
+        allocate(begin, end, coordinateOrder);
+    }
 }
 
-template<class A>
-inline CoordinateOrder& 
-Geometry<A>::coordinateOrder()
-{ 
-    return coordinateOrder_; 
+// frees the memory and leaves the PaddedMarray un-initialized
+template<class T, std::size_t ALIGNMENT>
+inline void
+PaddedMarray<T, ALIGNMENT>::deallocate()
+{
+    if(this->data_ != 0) {
+        dataAllocator_.deallocate(this->data_, allocatedSize_);
+        allocatedSize_ = 0;
+        base::assign();
+    }
 }
 
-template<class A>
-inline const bool 
-Geometry<A>::isSimple() const 
-{ 
-    return isSimple_; 
-}
+// implementation of n-ary element-wise operations
 
-template<class A>
-inline bool& 
-Geometry<A>::isSimple()
-{ 
-    return isSimple_; 
+/// Apply a functor to corresponding entries of Views of equal shape.
+///
+/// For every coordinate tuple c, f(v(c), w[0](c), ..., w[k-1](c)) is 
+/// called, in an unspecified order. All Views are traversed together in 
+/// a single pass over memory: The loops are ordered by the strides of v,
+/// and dimensions that can be traversed as one by all Views are merged.
+/// Computations on several operands, e.g. y = a*x + y, thus touch every 
+/// entry once. To traverse Views of the same geometry repeatedly, 
+/// construct a TraversalPlan once and execute it for every call.
+/// The Views may be mutable or constant and may have 
+/// different value types. The functor receives references to the entries
+/// and can therefore change the entries of mutable Views.
+///
+/// \param f Functor.
+/// \param v View that determines the order of traversal.
+/// \param w Further Views of the same shape as v.
+/// \return The functor after all calls.
+///
+/// \sa transform(), TraversalPlan
+///
+template<class Functor, class T, bool isConst, class A, class... Ts, bool... isConsts, class... As>
+inline Functor
+forEach
+(
+    Functor f,
+    const View<T, isConst, A>& v,
+    const View<Ts, isConsts, As>&... w
+)
+{
+    const TraversalPlan<sizeof...(Ts) + 1> plan(v, w...);
+    return plan.execute(f, &v(0), &w(0)...);
 }
 
-template<class A>
+/// Assign the result of a functor of entries of Views to a View.
+///
+/// For every coordinate tuple c, out(c) = f(in[0](c), ..., in[k-1](c)).
+/// out and all inputs are traversed in a single pass over memory, 
+/// cf. forEach(). If out overlaps with an input, the input has to be
+/// identical to out, i.e. have the same data pointer and strides.
+///
+/// \param out View to which the results are assigned.
+/// \param f Functor.
+/// \param in Views of the same shape as out.
+///
+/// \sa forEach()
+///
+template<class T, class A, class Functor, class... Ts, bool... isConsts, class... As>
 inline void
-Geometry<A>::updateSimplicity()
-{ 
-    for(std::size_t j=0; j<dimension(); ++j) {
-        if(shapeStrides(j) != strides(j)) {
-            isSimple_ = false;
-            return;
-        }
-    }
-    isSimple_ = true; 
-    // a 0-dimensional geometry is simple
+transform
+(
+    View<T, false, A>& out,
+    Functor f,
+    const View<Ts, isConsts, As>&... in
+)
+{
+    forEach(marray_detail::TransformFunctor<Functor>(f), out, in...);
 }
 
-template<class ShapeIterator, class StridesIterator>
-inline void 
-stridesFromShape
+// implementation of reductions
+
+/// Sum of all entries of a View or ViewExpression.
+///
+/// Expressions such as (a - b) * (a - b) are evaluated entry by entry,
+/// without temporary arrays. The work is split among threads as for 
+/// element-wise operations (cf. setNumberOfThreads()). The order in which
+/// floating point numbers are added therefore depends on the number of 
+/// threads.
+///
+/// \param e View or ViewExpression.
+///
+/// \sa mean(), dot()
+///
+template<class E, class T>
+inline T
+sum
 (
-    ShapeIterator begin,
-    ShapeIterator end,
-    StridesIterator strideBegin,
-    const CoordinateOrder& coordinateOrder
-) 
+    const ViewExpression<E, T>& e
+)
 {
-    Assert(MARRAY_NO_ARG_TEST || std::distance(begin, end) != 0);
-    std::size_t dimension = std::distance(begin, end);
-    ShapeIterator shapeIt;
-    StridesIterator strideIt;
-    if(coordinateOrder == FirstMajorOrder) {
-        shapeIt = begin + (dimension-1);
-        strideIt = strideBegin + (dimension-1);
-        *strideIt = 1;
-        for(std::size_t j=1; j<dimension; ++j) {
-            std::size_t tmp = *strideIt;
-            --strideIt;
-            (*strideIt) = tmp * (*shapeIt);
-            --shapeIt;
-        }
-    }
-    else {
-        shapeIt = begin;
-        strideIt = strideBegin;
-        *strideIt = 1;
-        for(std::size_t j=1; j<dimension; ++j) {
-            std::size_t tmp = *strideIt;
-            ++strideIt;
-            (*strideIt) = tmp * (*shapeIt);
-            ++shapeIt;
-        }
-    }
+    typedef typename marray_detail::ComputeType<T>::type R; // float for Float16
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || e.size() != 0);
+    return static_cast<T>(marray_detail::reduceAll(e, R(), marray_detail::SumReduction<R>()));
 }
 
-template<unsigned short N, class Functor, class T, class A>
-struct OperateHelperUnary
+/// Minimum of all entries of a View or ViewExpression.
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline T
+min
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T, false, A>& v, 
-        Functor f, 
-        T* data
-    )
-    {
-        for(std::size_t j=0; j<v.shape(N-1); ++j) {
-            OperateHelperUnary<N-1, Functor, T, A>::operate(v, f, data);
-            data += v.strides(N-1);
-        }
-        data -= v.shape(N-1) * v.strides(N-1);
-    }
-};
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || e.size() != 0);
+    const T first = *typename E::ExpressionIterator(e);
+    return marray_detail::reduceAll(e, first, marray_detail::MinimumReduction<T>());
+}
 
+/// Maximum of all entries of a View or ViewExpression.
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline T
+max
+(
+    const ViewExpression<E, T>& e
+)
+{
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || e.size() != 0);
+    const T first = *typename E::ExpressionIterator(e);
+    return marray_detail::reduceAll(e, first, marray_detail::MaximumReduction<T>());
+}
 
-template<class Functor, class T, class A>
-struct OperateHelperUnary<0, Functor, T, A>
+/// Arithmetic mean of all entries of a View or ViewExpression.
+///
+/// The mean is computed in the value type of the expression, i.e. the
+/// sum of integers is divided by the number of entries in integer 
+/// arithmetic.
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline T
+mean
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T, false, A>& v, 
-        Functor f, 
-        T* data
-    )
-    { 
-        f(*data); 
-    }
-};
+    return sum(e) / static_cast<T>(e.size());
+}
 
-template<unsigned short N, class Functor, class T1, class T2, class A>
-struct OperateHelperBinaryScalar
+/// Sum of the squares of all entries of a View or ViewExpression.
+///
+/// The squared error between two arrays, for instance, is 
+/// squaredNorm(a - b).
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline T
+squaredNorm
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T1, false, A>& v, 
-        const T2& x, 
-        Functor f, 
-        T1* data
-    )
-    {
-        for(std::size_t j=0; j<v.shape(N-1); ++j) {
-            OperateHelperBinaryScalar<N-1, Functor, T1, T2, A>::operate(
-                v, x, f, data);
-            data += v.strides(N-1);
-        }
-        data -= v.shape(N-1) * v.strides(N-1);
-    }
-};
+    typedef typename marray_detail::ComputeType<T>::type R;
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || e.size() != 0);
+    return static_cast<T>(marray_detail::reduceAll(e, R(), marray_detail::SquaredNormReduction<R>()));
+}
 
-template<class Functor, class T1, class T2, class A>
-struct OperateHelperBinaryScalar<0, Functor, T1, T2, A>
+/// Euclidean norm of a View or ViewExpression.
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline T
+norm
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T1, false, A>& v, 
-        const T2& x, 
-        Functor f, 
-        T1* data
-    )
-    { 
-        f(*data, x); 
-    }
-};
+    typedef typename marray_detail::ComputeType<T>::type R;
+    marray_detail::Assert(MARRAY_NO_ARG_TEST || e.size() != 0);
+    return static_cast<T>(std::sqrt(marray_detail::reduceAll(e, R(), 
+        marray_detail::SquaredNormReduction<R>())));
+}
 
-template<unsigned short N, class Functor, class T1, class T2, 
-         bool isConst, class A1, class A2>
-struct OperateHelperBinary
+/// Number of entries of a View or ViewExpression that are nonzero.
+///
+/// For a comparison, this is the number of entries for which it holds, 
+/// e.g. count(a > 0).
+///
+/// \param e View or ViewExpression.
+///
+/// \sa any(), all(), where()
+///
+template<class E, class T>
+inline std::size_t
+count
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T1, false, A1>& v, 
-        const View<T2, isConst, A2>& w, 
-        Functor f, 
-        T1* data1,
-        const T2* data2
-    )
-    {
-        for(std::size_t j=0; j<v.shape(N-1); ++j) {
-            OperateHelperBinary<N-1, Functor, T1, T2, isConst, A1, A2>::operate(
-                v, w, f, data1, data2);
-            data1 += v.strides(N-1);
-            data2 += w.strides(N-1);
-        }
-        data1 -= v.shape(N-1) * v.strides(N-1);
-        data2 -= w.shape(N-1) * w.strides(N-1);
-    }
-};
+    return marray_detail::reduceAll(e, std::size_t(0), marray_detail::CountReduction<T>());
+}
 
-template<class Functor, class T1, class T2, bool isConst, class A1, class A2>
-struct OperateHelperBinary<0, Functor, T1, T2, isConst, A1, A2>
+/// Test whether any entry of a View or ViewExpression is nonzero.
+///
+/// Unlike count(), the traversal stops at the first nonzero entry, also
+/// in the threads that work on other parts of the expression.
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline bool
+any
+(
+    const ViewExpression<E, T>& e
+)
 {
-    static inline void operate
-    (
-        View<T1, false, A1>& v, 
-        const View<T2, isConst, A2>& w, 
-        Functor f, 
-        T1* data1,
-        const T2* data2
-    )
-    {
-        f(*data1, *data2); 
-    }
-};
+    return marray_detail::anyOf(e, marray_detail::IsNonzero<T>());
+}
 
-template<class TFrom, class TTo, class AFrom, class ATo> 
-struct AssignmentOperatorHelper<false, TFrom, TTo, AFrom, ATo>
+/// Test whether all entries of a View or ViewExpression are nonzero.
+///
+/// The traversal stops at the first entry that is zero, cf. any().
+///
+/// \param e View or ViewExpression.
+///
+template<class E, class T>
+inline bool
+all
+(
+    const ViewExpression<E, T>& e
+)
 {
-    // from constant to mutable 
-    //
-    // here, 'to' must be initialized (which is asserted) because
-    // otherwise, the pointer to.data_ to mutable data would have 
-    // to be initialized with the pointer from.data_ to constant 
-    // data which we don't do.
-    //
-    static void execute
-    (
-        const View<TFrom, true, AFrom>& from,
-        View<TTo, false, ATo>& to
-    )
-    {
-        typedef typename View<TFrom, true, AFrom>::const_iterator FromIterator;
-        typedef typename View<TTo, false, ATo>::iterator ToIterator;
-        if(!MARRAY_NO_ARG_TEST) {
-            Assert(from.data_ != 0 && from.dimension() == to.dimension());
-            for(std::size_t j=0; j<from.dimension(); ++j) {
-                Assert(from.shape(j) == to.shape(j));
-            }
-        }
-        if(from.overlaps(to)) {
-            Marray<TFrom, AFrom> m = from; // temporary copy
-            execute(m, to);
-        }
-        else if(from.coordinateOrder() == to.coordinateOrder() 
-                && from.isSimple() && to.isSimple()
-                && IsEqual<TFrom, TTo>::type) {
-            memcpy(to.data_, from.data_, (from.size())*sizeof(TFrom));
-        }
-        else if(from.dimension() == 1)
-            OperateHelperBinary<1, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 2)
-            OperateHelperBinary<2, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 3)
-            OperateHelperBinary<3, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 4)
-            OperateHelperBinary<4, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 5)
-            OperateHelperBinary<5, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 6)
-            OperateHelperBinary<6, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 7)
-            OperateHelperBinary<7, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 8)
-            OperateHelperBinary<8, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 9)
-            OperateHelperBinary<9, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else if(from.dimension() == 10)
-            OperateHelperBinary<10, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-        else {
-            FromIterator itFrom = from.begin();
-            ToIterator itTo = to.begin();
-            for(; itFrom.hasMore(); ++itFrom, ++itTo) {
-                *itTo = static_cast<TTo>(*itFrom);
-            }
-        }
-    }
+    return !marray_detail::anyOf(e, marray_detail::IsZero<T>());
+}
 
-    /// from mutable to mutable.
-    ///
-    /// here, 'to' need not be initialized.
-    ///
-    static void execute
-    (
-        const View<TFrom, false, AFrom>& from,
-        View<TTo, false, ATo>& to
-    )
-    {
-        typedef typename View<TFrom, false, AFrom>::const_iterator FromIterator;
-        typedef typename View<TTo, false, ATo>::iterator ToIterator;
-        if(static_cast<const void*>(&from) != static_cast<const void*>(&to)) { // no self-assignment
-            if(to.data_ == 0) { // if the view 'to' is not initialized
-                // initialize the view 'to' with source data
-                Assert(MARRAY_NO_ARG_TEST || sizeof(TTo) == sizeof(TFrom));
-                to.data_ = static_cast<TTo*>(static_cast<void*>(from.data_)); // copy pointer
-                to.geometry_ = from.geometry_;
-            }
-            else { // if the view 'to' is initialized
-                if(!MARRAY_NO_ARG_TEST) {
-                    Assert(from.data_ != 0 && from.dimension() == to.dimension());
-                    for(std::size_t j=0; j<from.dimension(); ++j) {
-                        Assert(from.shape(j) == to.shape(j));
-                    }
-                }
-                if(from.overlaps(to)) {
-                    Marray<TFrom, AFrom> m = from; // temporary copy
-                    execute(m, to);
-                }
-                else if(from.coordinateOrder() == to.coordinateOrder() 
-                        && from.isSimple() && to.isSimple()
-                        && IsEqual<TFrom, TTo>::type) {
-                    memcpy(to.data_, from.data_, (from.size())*sizeof(TFrom));
-                }
-                else if(from.dimension() == 1)
-                    OperateHelperBinary<1, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 2)
-                    OperateHelperBinary<2, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 3)
-                    OperateHelperBinary<3, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 4)
-                    OperateHelperBinary<4, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 5)
-                    OperateHelperBinary<5, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 6)
-                    OperateHelperBinary<6, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 7)
-                    OperateHelperBinary<7, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 8)
-                    OperateHelperBinary<8, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 9)
-                    OperateHelperBinary<9, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else if(from.dimension() == 10)
-                    OperateHelperBinary<10, Assign<TTo, TFrom>, TTo, TFrom, true, ATo, AFrom>::operate(to, from, Assign<TTo, TFrom>(), &to(0), &from(0));
-                else {
-                    FromIterator itFrom = from.begin();
-                    ToIterator itTo = to.begin();
-                    for(; itFrom.hasMore(); ++itFrom, ++itTo) {
-                        *itTo = static_cast<TTo>(*itFrom);
-                    }
-                }
-            }
-        }
-    }
-};
+/// Inner product of two Views or ViewExpressions of equal shape.
+///
+/// \param e1 View or ViewExpression.
+/// \param e2 View or ViewExpression.
+///
+template<class E1, class T1, class E2, class T2>
+inline typename marray_detail::PromoteType<T1, T2>::type
+dot
+(
+    const ViewExpression<E1, T1>& e1,
+    const ViewExpression<E2, T2>& e2
+)
+{
+    return sum(e1 * e2);
+}
 
-template<class TFrom, class TTo, class AFrom, class ATo> 
-struct AssignmentOperatorHelper<true, TFrom, TTo, AFrom, ATo>
+/// Reduce a View along one dimension.
+///
+/// The result has one dimension less than v. Its entry at the coordinates
+/// (c[0], ..., c[axis-1], c[axis+1], ..., c[n-1]) is obtained by folding 
+/// the entries v(c[0], ..., c[axis-1], k, c[axis+1], ..., c[n-1]) for 
+/// k = 0, 1, ..., v.shape(axis)-1 with the binary functor f, i.e.
+/// r = f(r, x) starting from the entry for k = 0. If v has only one
+/// dimension, the result is a scalar Marray.
+///
+/// The traversal is chosen according to the strides of v: If the entries
+/// along the axis are adjacent in memory, each entry of the result is 
+/// computed in one pass along the axis. Otherwise, the slices along the 
+/// axis are folded into the result one after the other, each slice in the
+/// order of memory. In both cases, the work is split among threads along
+/// the dimensions that are kept (cf. setNumberOfThreads()).
+///
+/// \param v View.
+/// \param axis Dimension along which v is reduced.
+/// \param f Binary functor, e.g. std::plus<T>().
+/// \return Marray with the coordinate order of v.
+///
+/// \sa sum(), min(), max(), mean(), argmin(), argmax()
+///
+template<class T, bool isConst, class A, class BinaryFunctor>
+inline Marray<T, A>
+reduce
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis,
+    BinaryFunctor f
+)
 {
-    /// from either constant or mutable to constant
-    template<bool isConstFrom>
-    static void execute
-    (
-        const View<TFrom, isConstFrom, AFrom>& from,
-        View<TTo, true, ATo>& to
-    )
-    {
-        Assert(MARRAY_NO_ARG_TEST || sizeof(TFrom) == sizeof(TTo));
-        to.data_ = static_cast<const TTo*>(
-            static_cast<const void*>(from.data_)); // copy pointer
-        to.geometry_ = from.geometry_;
-    }
-};
+    return marray_detail::reduceAxis(v, axis, 
+        marray_detail::Accumulate<T, BinaryFunctor>(f));
+}
 
-template<>
-struct AccessOperatorHelper<true>
+/// Sum of a View along one dimension.
+///
+/// \param v View.
+/// \param axis Dimension along which v is summed.
+///
+/// \sa reduce()
+///
+template<class T, bool isConst, class A>
+inline Marray<T, A>
+sum
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis
+)
 {
-    // access by scalar index
-    template<class T, class U, bool isConst, class A>
-    static typename View<T, isConst, A>::reference
-    execute(const View<T, isConst, A>& v, const U& index)
-    {
-        v.testInvariant();
-        Assert(MARRAY_NO_DEBUG || v.data_ != 0);
-        Assert(MARRAY_NO_DEBUG || v.dimension() != 0 || index == 0);
-        std::size_t offset;
-        v.indexToOffset(index, offset);
-        return v.data_[offset];
-    }
-};
+    return marray_detail::reduceAxis(v, axis, marray_detail::PlusEqual<T, T>());
+}
 
-template<>
-struct AccessOperatorHelper<false>
+/// Minimum of a View along one dimension.
+///
+/// \param v View.
+/// \param axis Dimension along which the minimum is taken.
+///
+/// \sa reduce(), argmin()
+///
+template<class T, bool isConst, class A>
+inline Marray<T, A>
+min
+(
+    const View<T, isConst, A>& v,
+    const std::size_t axis
+)
 {
-    // access by iterator
-    template<class T, class U, bool isConst, class A>
-    static typename View<T, isConst, A>::reference
-    execute(const View<T, isConst, A>& v, U it)
-    {
-        v.testInvariant();
-        Assert(MARRAY_NO_DEBUG || v.data_ != 0);
-        Assert(MARRAY_NO_DEBUG || v.dimension() != 0 || *it == 0);
-        std::size_t offset;
-        v.coordinatesToOffset(it, offset);
-        return v.data_[offset];
-    }
-};
+    return marray_detail::reduceAxis(v, axis, marray_detail::MinimumReduction<T>());
+}
 
-template<class Functor, class T, class A>
-inline void 
-operate
+/// Maximum of a View along one dimension, e.g. a maximum projection.
+///
+/// \param v View.
+/// \param axis Dimension along which the maximum is taken.
+///
+/// \sa reduce(), argmax()
+///
+template<class T, bool isConst, class A>
+inline Marray<T, A>
+max
 (
-    View<T, false, A>& v, 
-    Functor f
+    const View<T, isConst, A>& v,
+    const std::size_t axis
 )
 {
-    if(v.isSimple()) {
-        T* data = &v(0);
-        for(std::size_t j=0; j<v.size(); ++j) {
-            f(data[j]);
-        }
-    }
-    else if(v.dimension() == 1)
-        OperateHelperUnary<1, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 2)
-        OperateHelperUnary<2, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 3)
-        OperateHelperUnary<3, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 4)
-        OperateHelperUnary<4, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 5)
-        OperateHelperUnary<5, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 6)
-        OperateHelperUnary<6, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 7)
-        OperateHelperUnary<7, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 8)
-        OperateHelperUnary<8, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 9)
-        OperateHelperUnary<9, Functor, T, A>::operate(v, f, &v(0));
-    else if(v.dimension() == 10)
-        OperateHelperUnary<10, Functor, T, A>::operate(v, f, &v(0));
-    else {
-        for(typename View<T, false, A>::iterator it = v.begin(); it.hasMore(); ++it) {
-            f(*it);
-        }
-    }
+    return marray_detail::reduceAxis(v, axis, marray_detail::MaximumReduction<T>());
 }
 
-template<class Functor, class T, class A>
-inline void 
-operate
+/// Arithmetic mean of a View along one dimension.
+///
+/// As for mean() of all entries, the sum is divided in the value type
+/// of the View.
+///
+/// \param v View.
+/// \param axis Dimension along which the mean is taken.
+///
+/// \sa reduce()
+///
+template<class T, bool isConst, class A>
+inline Marray<T, A>
+mean
 (
-    View<T, false, A>& v, 
-    const T& x, 
-    Functor f
+    const View<T, isConst, A>& v,
+    const std::size_t axis
 )
 {
-    if(v.isSimple()) {
-        T* data = &v(0);
-        for(std::size_t j=0; j<v.size(); ++j) {
-            f(data[j], x);
-        }
-    }
-    else if(v.dimension() == 1)
-        OperateHelperBinaryScalar<1, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 2)
-        OperateHelperBinaryScalar<2, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 3)
-        OperateHelperBinaryScalar<3, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 4)
-        OperateHelperBinaryScalar<4, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 5)
-        OperateHelperBinaryScalar<5, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 6)
-        OperateHelperBinaryScalar<6, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 7)
-        OperateHelperBinaryScalar<7, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 8)
-        OperateHelperBinaryScalar<8, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 9)
-        OperateHelperBinaryScalar<9, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else if(v.dimension() == 10)
-        OperateHelperBinaryScalar<10, Functor, T, T, A>::operate(v, x, f, &v(0));
-    else {
-        for(typename View<T, false, A>::iterator it = v.begin(); it.hasMore(); ++it) {
-            f(*it, x); 
-        }
-    }
+    Marray<T, A> out = sum(v, axis);
+    out /= static_cast<T>(v.shape(axis));
+    return out;
 }
 
-template<class Functor, class T1, class T2, bool isConst, class A>
-inline void 
-operate
+/// Indices of the minima of a View along one dimension.
+///
+/// If the minimum is attained more than once, the smallest index is 
+/// returned.
+///
+/// \param v View.
+/// \param axis Dimension along which the minima are searched.
+///
+/// \sa min()
+///
+template<class T, bool isConst, class A>
+inline Marray<std::size_t, A>
+argmin
 (
-    View<T1, false, A>& v, 
-    const View<T2, isConst, A>& w, 
-    Functor f
+    const View<T, isConst, A>& v,
+    const std::size_t axis
 )
 {
-    if(!MARRAY_NO_ARG_TEST) {
-        Assert(v.size() != 0 && w.size() != 0);
-        Assert(w.dimension() == 0 || v.dimension() == w.dimension());
-        if(w.dimension() != 0) {
-            for(std::size_t j=0; j<v.dimension(); ++j) {
-                Assert(v.shape(j) == w.shape(j));
-            }
-        }
-    }
-    if(w.dimension() == 0) {
-        T2 x = w(0);
-        if(v.isSimple()) {
-            T1* dataV = &v(0);
-            for(std::size_t j=0; j<v.size(); ++j) {
-                f(dataV[j], x);
-            }
-        }
-        else if(v.dimension() == 1)
-            OperateHelperBinaryScalar<1, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 2)
-            OperateHelperBinaryScalar<2, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 3)
-            OperateHelperBinaryScalar<3, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 4)
-            OperateHelperBinaryScalar<4, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 5)
-            OperateHelperBinaryScalar<5, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 6)
-            OperateHelperBinaryScalar<6, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 7)
-            OperateHelperBinaryScalar<7, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 8)
-            OperateHelperBinaryScalar<8, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 9)
-            OperateHelperBinaryScalar<9, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else if(v.dimension() == 10)
-            OperateHelperBinaryScalar<10, Functor, T1, T2, A>::operate(v, x, f, &v(0));
-        else {
-            for(typename View<T1, false>::iterator it = v.begin(); it.hasMore(); ++it) {
-                f(*it, x);
-            }
-        }
-    }
-    else {
-        if(v.overlaps(w)) {
-            Marray<T2> m = w; // temporary copy
-            operate(v, m, f); // recursive call
-        }
-        else {
-            if(v.coordinateOrder() == w.coordinateOrder() 
-                && v.isSimple() && w.isSimple()) {
-                T1* dataV = &v(0);
-                const T2* dataW = &w(0);
-                for(std::size_t j=0; j<v.size(); ++j) {
-                    f(dataV[j], dataW[j]);
-                }
-            }
-            else if(v.dimension() == 1)
-                OperateHelperBinary<1, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 2)
-                OperateHelperBinary<2, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 3)
-                OperateHelperBinary<3, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 4)
-                OperateHelperBinary<4, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 5)
-                OperateHelperBinary<5, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 6)
-                OperateHelperBinary<6, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 7)
-                OperateHelperBinary<7, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 8)
-                OperateHelperBinary<8, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 9)
-                OperateHelperBinary<9, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else if(v.dimension() == 10)
-                OperateHelperBinary<10, Functor, T1, T2, isConst, A, A>::operate(v, w, f, &v(0), &w(0));
-            else {
-                typename View<T1, false>::iterator itV = v.begin();
-                typename View<T2, isConst>::const_iterator itW = w.begin();
-                for(; itV.hasMore(); ++itV, ++itW) {
-                    Assert(MARRAY_NO_DEBUG || itW.hasMore());
-                    f(*itV, *itW);
-                }
-                Assert(MARRAY_NO_DEBUG || !itW.hasMore());
-            }
-        }
-    }
+    return marray_detail::argReduceAxis(v, axis, std::less<T>());
 }
 
-template<class Functor, class T1, class A, class E, class T2>
-inline void operate
+/// Indices of the maxima of a View along one dimension.
+///
+/// If the maximum is attained more than once, the smallest index is 
+/// returned.
+///
+/// \param v View.
+/// \param axis Dimension along which the maxima are searched.
+///
+/// \sa max()
+///
+template<class T, bool isConst, class A>
+inline Marray<std::size_t, A>
+argmax
 (
-    View<T1, false, A>& v, 
-    const ViewExpression<E, T2>& expression, 
-    Functor f
+    const View<T, isConst, A>& v,
+    const std::size_t axis
 )
 {
-    const E& e = expression; // cast
-    if(!MARRAY_NO_DEBUG) {
-        Assert(v.size() != 0 && e.size() != 0);
-        Assert(e.dimension() == v.dimension());
-        if(v.dimension() == 0) {
-            Assert(v.size() == 1 && e.size() == 1);
-        }
-        else {
-            for(std::size_t j=0; j<v.dimension(); ++j) {
-                Assert(v.shape(j) == e.shape(j));
-            }
-        }
-    }
-    if(e.overlaps(v)) {
-        Marray<T1, A> m(e); // temporary copy
-        operate(v, m, f);
-    }
-    else if(v.dimension() == 0) {
-        f(v[0], e[0]);
-    }
-    else if(v.isSimple() && e.isSimple() 
-    && v.coordinateOrder() == e.coordinateOrder()) {
-        for(std::size_t j=0; j<v.size(); ++j) {
-            f(v[j], e[j]);
-        }
-    }
-    else {
-        // loop unrolling does not improve performance here
-        typename E::ExpressionIterator itE(e);
-        std::size_t offsetV = 0;
-        std::vector<std::size_t> coordinate(v.dimension());
-        std::size_t maxDimension = v.dimension() - 1;
-        for(;;) {
-            f(v[offsetV], *itE);
-            for(std::size_t j=0; j<v.dimension(); ++j) {
-                if(coordinate[j]+1 == v.shape(j)) {
-                    if(j == maxDimension) {
-                        return;
-                    }
-                    else {
-                        offsetV -= coordinate[j] * v.strides(j);
-                        itE.resetCoordinate(j);
-                        coordinate[j] = 0;
-                    }
-                }
-                else {
-                    offsetV += v.strides(j);
-                    itE.incrementCoordinate(j);
-                    ++coordinate[j];
-                    break;
-                }
-            }
-        }
-    }
+    return marray_detail::argReduceAxis(v, axis, std::greater<T>());
 }
 
-} // namespace marray_detail
-// \endcond suppress_doxygen
+// implementation of permutation
+
+/// Copy the entries of a View into a View with permuted dimensions.
+///
+/// After the call, out(c[0], ..., c[n-1]) equals in(d[0], ..., d[n-1]) 
+/// where d[permutation[j]] = c[j], i.e. out contains the entries of
+/// in.permutedView(permutation). If the orders in which in and out are 
+/// stored in memory disagree, the copy is carried out in tiles that fit
+/// into the L1 cache. The same is done automatically when a View is 
+/// assigned to a View or Marray with a different coordinate order or 
+/// a permuted stride pattern.
+///
+/// \param in View whose entries are copied.
+/// \param permutation Iterator to the beginning of a sequence which
+/// has to contain the integers 0, ..., in.dimension()-1 in any order.
+/// \param out View to which the entries are copied. Its shape has
+/// to be the shape of in.permutedView(permutation).
+///
+/// \sa View::permutedView()
+///
+template<class T1, bool isConst, class A1, class CoordinateIterator, class T2, class A2>
+inline void
+permuteCopy
+(
+    const View<T1, isConst, A1>& in,
+    CoordinateIterator permutation,
+    View<T2, false, A2>& out
+)
+{
+    View<T1, isConst, A1> v = in.permutedView(permutation);
+    marray_detail::operate(out, v, marray_detail::Assign<T2, T1>());
+}
+
+/// Copy the entries of a View into a View with permuted dimensions.
+///
+/// \param in View whose entries are copied.
+/// \param permutation Initializer list which has to contain the 
+/// integers 0, ..., in.dimension()-1 in any order.
+/// \param out View to which the entries are copied. Its shape has
+/// to be the shape of in.permutedView(permutation).
+///
+/// \sa View::permutedView()
+///
+template<class T1, bool isConst, class A1, class T2, class A2>
+inline void
+permuteCopy
+(
+    const View<T1, isConst, A1>& in,
+    std::initializer_list<std::size_t> permutation,
+    View<T2, false, A2>& out
+)
+{
+    permuteCopy(in, permutation.begin(), out);
+}
 
 } // namespace andres
 
@@ -41,6 +41,8 @@ int main() {
     { MarrayHDF5Test t; t.saveLoadTest<long, andres::FirstMajorOrder>(); }
     { MarrayHDF5Test t; t.saveLoadTest<float, andres::FirstMajorOrder>(); }
     { MarrayHDF5Test t; t.saveLoadTest<double, andres::FirstMajorOrder>(); }
+    { MarrayHDF5Test t; t.saveLoadTest<andres::Float16, andres::FirstMajorOrder>(); }
+    { MarrayHDF5Test t; t.saveLoadTest<andres::BFloat16, andres::FirstMajorOrder>(); }
 
     { MarrayHDF5Test t; t.loadHyperslabTest<int, andres::FirstMajorOrder>(); }
 
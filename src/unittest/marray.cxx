@@ -2,6 +2,7 @@
 //
 #include <vector>
 #include <iostream>
+#include <algorithm> // std::next_permutation
 
 #include "andres/marray.hxx"
 
@@ -12,9 +13,30 @@ struct TestType {
     std::size_t data_;
 };
 
+// counts allocations, e.g. to test that operations need no temporary copy
+inline std::size_t& numberOfAllocations()
+    { static std::size_t count = 0; return count; }
+
+template<class T>
+class CountingAllocator 
+: public std::allocator<T> {
+public:
+    template<class U>
+        struct rebind { typedef CountingAllocator<U> other; };
+    CountingAllocator()
+        {}
+    template<class U>
+        CountingAllocator(const CountingAllocator<U>&)
+            {}
+    T* allocate(const std::size_t n, const void* = 0)
+        { ++numberOfAllocations(); return std::allocator<T>::allocate(n); }
+};
+
 class GlobalFunctionTest {
 public:
     void shapeStrideTest();
+    void coalesceDimensionsTest();
+    void orderDimensionsTest();
 };
 
 class ViewTest {
@@ -67,11 +89,19 @@ public:
     template<bool constTarget, andres::CoordinateOrder internalFirstMajorOrder>
         void shiftOperatorTest();
     void arithmeticOperatorsTest();
+    template<andres::CoordinateOrder coordinateOrder>
+        void subViewArithmeticTest();
+    void highDimensionalArithmeticTest();
     template<bool constTarget>
         void asStringTest();
     void reshapeTest();
     void overlapTreatmentTest();
+    void exactOverlapTest();
+    void inPlaceExpressionTest();
+    void scratchMemoryTest();
+    void inlineGeometryTest();
     void compatibilityFunctionsTest();
+    void permuteCopyTest();
 };
 
 class IteratorTest {
@@ -111,6 +141,7 @@ public:
         void copyConstructorTest();
     template<bool constTarget>
         void assignmentOperatorTest();
+    void moveTest();
     void reshapeTest();
     template<andres::CoordinateOrder coordinateOrder>
         void resizeTest();
@@ -141,6 +172,99 @@ public:
     void typePromotionTest();
 };
 
+class ContiguousKernelTest {
+public:
+    template<class T>
+        void arithmeticOperatorsTest();
+    template<class T>
+        void streamingTest();
+};
+
+class MathFunctionTest {
+public:
+    template<class T>
+        void elementaryFunctionsTest();
+    template<class T>
+        void specialValuesTest();
+    void integerTest();
+};
+
+class MaskTest {
+public:
+    template<class T>
+        void comparisonTest();
+    template<class T>
+        void whereTest();
+    void countAnyAllTest();
+};
+
+class Float16Test {
+public:
+    void conversionTest();
+    template<class H>
+        void viewConversionTest();
+    template<class H>
+        void arithmeticTest();
+};
+
+class FixedRankTest {
+public:
+    template<andres::CoordinateOrder coordinateOrder>
+        void viewTest();
+    void marrayTest();
+};
+
+class FixedShapeTest {
+public:
+    void constructionAndAssignmentTest();
+    void arithmeticOperatorsTest();
+    void viewTest();
+};
+
+class AlignmentTest {
+public:
+    void alignedAllocatorTest();
+    template<andres::CoordinateOrder coordinateOrder>
+        void paddedMarrayTest();
+};
+
+class ForEachTest {
+public:
+    void forEachTest();
+    void transformTest();
+    void traversalPlanTest();
+};
+
+class BroadcastTest {
+public:
+    void broadcastedViewTest();
+    template<andres::CoordinateOrder coordinateOrder>
+        void compoundAssignmentTest();
+    template<andres::CoordinateOrder coordinateOrder>
+        void expressionTest();
+};
+
+class ReductionTest {
+public:
+    void reductionTest();
+    void expressionReductionTest();
+    template<andres::CoordinateOrder coordinateOrder>
+        void axisReductionTest();
+};
+
+class ParallelExecutionTest {
+public:
+    ParallelExecutionTest();
+    ~ParallelExecutionTest();
+    void operateTest();
+    void expressionTest();
+    void reductionTest();
+    template<class T>
+        void rowExpressionTest();
+    void axisReductionTest();
+    void allocationTest();
+};
+
 // implementation
 
 void GlobalFunctionTest::shapeStrideTest() {
@@ -176,6 +300,84 @@ void GlobalFunctionTest::shapeStrideTest() {
     }
 }
 
+void GlobalFunctionTest::orderDimensionsTest() {
+    // destination in first major order
+    {
+        std::size_t shape[] = {5, 4, 3};
+        std::size_t strides1[] = {12, 3, 1};
+        std::size_t strides2[] = {1, 5, 20};
+        std::size_t* strides[] = {strides1, strides2};
+        andres::marray_detail::orderDimensions(3, shape, strides);
+        test(shape[0] == 3 && shape[1] == 4 && shape[2] == 5);
+        test(strides1[0] == 1 && strides1[1] == 3 && strides1[2] == 12);
+        test(strides2[0] == 20 && strides2[1] == 5 && strides2[2] == 1);
+    }
+    // ties are broken by the source
+    {
+        std::size_t shape[] = {2, 1, 3};
+        std::size_t strides1[] = {1, 2, 2};
+        std::size_t strides2[] = {3, 6, 1};
+        std::size_t* strides[] = {strides1, strides2};
+        andres::marray_detail::orderDimensions(3, shape, strides);
+        test(shape[0] == 2 && shape[1] == 3 && shape[2] == 1);
+        test(strides1[0] == 1 && strides1[1] == 2 && strides1[2] == 2);
+        test(strides2[0] == 3 && strides2[1] == 1 && strides2[2] == 6);
+    }
+    // already ordered
+    {
+        std::size_t shape[] = {5, 4, 3};
+        std::size_t strides1[] = {1, 5, 20};
+        std::size_t* strides[] = {strides1};
+        andres::marray_detail::orderDimensions(3, shape, strides);
+        test(shape[0] == 5 && shape[1] == 4 && shape[2] == 3);
+        test(strides1[0] == 1 && strides1[1] == 5 && strides1[2] == 20);
+    }
+}
+
+void GlobalFunctionTest::coalesceDimensionsTest() {
+    // crop of a [8, 6, 5, 1] array in last major order
+    {
+        std::size_t shape[] = {8, 4, 5, 1};
+        std::size_t strides1[] = {1, 8, 48, 240};
+        std::size_t strides2[] = {1, 8, 48, 240};
+        std::size_t* strides[] = {strides1, strides2};
+        std::size_t dimension = andres::marray_detail::coalesceDimensions(4, shape, strides);
+        test(dimension == 2);
+        test(shape[0] == 32 && shape[1] == 5);
+        test(strides1[0] == 1 && strides1[1] == 48);
+        test(strides2[0] == 1 && strides2[1] == 48);
+    }
+    // crop of a [5, 6, 8] array in first major order
+    {
+        std::size_t shape[] = {5, 4, 8};
+        std::size_t strides1[] = {48, 8, 1};
+        std::size_t* strides[] = {strides1};
+        std::size_t dimension = andres::marray_detail::coalesceDimensions(3, shape, strides);
+        test(dimension == 2);
+        test(shape[0] == 5 && shape[1] == 32);
+        test(strides1[0] == 48 && strides1[1] == 1);
+    }
+    // operands with different layouts are not coalesced
+    {
+        std::size_t shape[] = {4, 3, 1};
+        std::size_t strides1[] = {1, 4, 12};
+        std::size_t strides2[] = {3, 1, 12};
+        std::size_t* strides[] = {strides1, strides2};
+        std::size_t dimension = andres::marray_detail::coalesceDimensions(3, shape, strides);
+        test(dimension == 2);
+        test(shape[0] == 4 && shape[1] == 3);
+        test(strides1[0] == 1 && strides1[1] == 4);
+        test(strides2[0] == 3 && strides2[1] == 1);
+    }
+    // singleton dimensions only
+    {
+        std::size_t shape[] = {1, 1};
+        std::size_t strides1[] = {1, 7};
+        std::size_t* strides[] = {strides1};
+        test(andres::marray_detail::coalesceDimensions(2, shape, strides) == 0);
+    }
+}
+
 ViewTest::ViewTest() : scalar_(42) {
     for(int j=0; j<24; ++j) {
         data_[j] = j;
@@ -513,6 +715,11 @@ void ViewTest::scalarConstructorTest() {
 }
 
 void ViewTest::copyConstructorTest() {
+    // a View on mutable data cannot be constructed from a View on constant data
+    static_assert(std::is_constructible<andres::View<int, true>, const andres::View<int, false>&>::value, "");
+    static_assert(std::is_constructible<andres::View<int, true>, const andres::Marray<int>&>::value, "");
+    static_assert(!std::is_constructible<andres::View<int, false>, const andres::View<int, true>&>::value, "");
+
     // scalar 
     {
         // false, false
@@ -9068,6 +9275,199 @@ void ViewTest::reshapeTest()
     }
 }
 
+// more dimensions than there used to be specialized helper classes for
+// shape and strides of Views of small dimension are stored inline, those
+// of Views of higher dimension on the heap
+void ViewTest::inlineGeometryTest()
+{
+    // 12-dimensional, squeezed to 2 dimensions and reshaped to 10
+    {
+        std::vector<std::size_t> shape(12, 1);
+        shape[3] = 4;
+        shape[9] = 6;
+        andres::Marray<int> m(shape.begin(), shape.end(), 0);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        andres::View<int> v = m;
+        v.squeeze();
+        test(v.dimension() == 2 && v.shape(0) == 4 && v.shape(1) == 6);
+        test(v.strides(0) == m.strides(3) && v.strides(1) == m.strides(9));
+        for(std::size_t j=0; j<v.size(); ++j) {
+            test(v(j) == m(j));
+        }
+
+        std::vector<std::size_t> reshaped(10, 1);
+        reshaped[0] = 2;
+        reshaped[4] = 3;
+        reshaped[9] = 4;
+        v.reshape(reshaped.begin(), reshaped.end());
+        test(v.dimension() == 10);
+        for(std::size_t j=0; j<v.dimension(); ++j) {
+            test(v.shape(j) == reshaped[j]);
+        }
+        test(v(1, 0, 0, 0, 2, 0, 0, 0, 0, 3) == m(23));
+
+        // copies and moves across the inline dimension
+        andres::View<int> w = v;
+        test(w.dimension() == 10 && &w(0) == &m(0));
+        andres::View<int> x = std::move(w);
+        test(x.dimension() == 10 && x(23) == 23);
+        andres::View<int, true> c = x.squeezedView();
+        test(c.dimension() == 3 && c(1, 2, 3) == 23);
+        c = x;
+        test(c.dimension() == 10 && c(23) == 23);
+        andres::Marray<int> n = std::move(m);
+        test(n.dimension() == 12 && n(23) == 23);
+    }
+    // coordinates of iterators over views of either kind
+    for(std::size_t dimension = 7; dimension < 11; ++dimension) {
+        std::vector<std::size_t> shape(dimension, 2);
+        andres::Marray<int> m(shape.begin(), shape.end(), 0);
+        andres::Marray<int>::iterator it = m.begin();
+        it += 5;
+        andres::Marray<int>::iterator jt = it;
+        std::vector<std::size_t> coordinate(dimension);
+        jt.coordinate(coordinate.begin());
+        for(std::size_t j=0; j<dimension; ++j) {
+            test(coordinate[j] == ((5 >> j) & 1));
+        }
+        std::size_t count = 0;
+        for(; jt.hasMore(); ++jt) {
+            ++count;
+        }
+        test(count == m.size() - 5);
+    }
+}
+
+void ViewTest::highDimensionalArithmeticTest()
+{
+    std::vector<std::size_t> shape(13, 2);
+    shape[0] = 3;
+    shape[7] = 3;
+    andres::Marray<int> m(shape.begin(), shape.end(), 0);
+    andres::Marray<int> n(shape.begin(), shape.end(), 0);
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<int>(j);
+        n(j) = static_cast<int>(j % 11);
+    }
+    const andres::Marray<int> original = m;
+    std::vector<std::size_t> base(13, 0);
+    base[7] = 1;
+    std::vector<std::size_t> viewShape = shape;
+    viewShape[0] = 2;
+    viewShape[7] = 2;
+    andres::View<int> v = m.view(base.begin(), viewShape.begin());
+    andres::View<int, true> w = n.constView(base.begin(), viewShape.begin());
+    andres::View<int, true> u = original.constView(base.begin(), viewShape.begin());
+    v += w;
+    v *= 3;
+    --v;
+    andres::View<int>::iterator itV = v.begin();
+    andres::View<int, true>::const_iterator itW = w.begin();
+    andres::View<int, true>::const_iterator itU = u.begin();
+    for(; itV.hasMore(); ++itV, ++itW, ++itU) {
+        test(*itV == (*itU + *itW) * 3 - 1);
+    }
+    int sum = 0;
+    int originalSum = 0;
+    for(std::size_t j=0; j<m.size(); ++j) {
+        sum += m(j);
+        originalSum += original(j);
+    }
+    int viewSum = 0;
+    for(std::size_t j=0; j<v.size(); ++j) {
+        viewSum += v(j) - u(j);
+    }
+    test(sum == originalSum + viewSum);
+
+    andres::View<int> t = v.transposedView();
+    andres::Marray<int> p = t;
+    for(std::size_t j=0; j<t.size(); ++j) {
+        test(p(j) == t(j));
+    }
+}
+
+void ViewTest::permuteCopyTest()
+{
+    // 3-dimensional, all permutations
+    {
+        andres::Marray<int> m({7, 5, 3}, 0);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        std::size_t permutation[] = {0, 1, 2};
+        do {
+            andres::Marray<int> out({m.shape(permutation[0]), m.shape(permutation[1]), 
+                m.shape(permutation[2])}, 0);
+            andres::permuteCopy(m, permutation, out);
+            std::size_t c[3];
+            for(c[0]=0; c[0]<out.shape(0); ++c[0])
+            for(c[1]=0; c[1]<out.shape(1); ++c[1])
+            for(c[2]=0; c[2]<out.shape(2); ++c[2]) {
+                std::size_t d[3];
+                for(std::size_t j=0; j<3; ++j) {
+                    d[permutation[j]] = c[j];
+                }
+                test(out(c[0], c[1], c[2]) == m(d[0], d[1], d[2]));
+            }
+        } while(std::next_permutation(permutation, permutation + 3));
+    }
+    // transposition larger than one tile, into a strided View
+    {
+        andres::Marray<double> m({150, 70, 2}, 0.0, andres::FirstMajorOrder);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<double>(j);
+        }
+        andres::Marray<double> n({75, 151}, 0.0);
+        std::size_t base[] = {3, 1};
+        std::size_t shape[] = {70, 150};
+        andres::View<double> v = n.view(base, shape);
+        andres::View<double, true> w = m.boundView(2, 1);
+        andres::permuteCopy(w, {1, 0}, v);
+        for(std::size_t x=0; x<150; ++x)
+        for(std::size_t y=0; y<70; ++y) {
+            test(n(y + 3, x + 1) == m(x, y, 1));
+        }
+        test(n(2, 0) == 0.0 && n(74, 150) == 0.0);
+    }
+}
+
+// sub-views whose dimensions are (partially) coalesced
+template<andres::CoordinateOrder coordinateOrder>
+void ViewTest::subViewArithmeticTest()
+{
+    andres::Marray<int> m({8, 6, 1, 5}, 0, coordinateOrder);
+    andres::Marray<int> n({8, 6, 1, 5}, 0, coordinateOrder);
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<int>(j);
+        n(j) = static_cast<int>(3 * j);
+    }
+    const andres::Marray<int> original = m;
+    std::size_t bases[][4] = {{0, 1, 0, 0}, {2, 0, 0, 1}, {1, 1, 0, 2}};
+    std::size_t shapes[][4] = {{8, 4, 1, 5}, {3, 6, 1, 4}, {1, 4, 1, 1}};
+    for(std::size_t k=0; k<3; ++k) {
+        m = original;
+        andres::View<int> v = m.view(bases[k], shapes[k]);
+        andres::View<int, true> w = n.constView(bases[k], shapes[k]);
+        v += w;
+        v *= 2;
+        ++v;
+        for(std::size_t x=0; x<8; ++x)
+        for(std::size_t y=0; y<6; ++y)
+        for(std::size_t z=0; z<5; ++z) {
+            if(x >= bases[k][0] && x < bases[k][0] + shapes[k][0]
+            && y >= bases[k][1] && y < bases[k][1] + shapes[k][1]
+            && z >= bases[k][3] && z < bases[k][3] + shapes[k][3]) {
+                test(m(x, y, 0, z) == (original(x, y, 0, z) + n(x, y, 0, z)) * 2 + 1);
+            }
+            else {
+                test(m(x, y, 0, z) == original(x, y, 0, z));
+            }
+        }
+    }
+}
+
 void ViewTest::overlapTreatmentTest()
 {
     {
@@ -9168,6 +9568,242 @@ void ViewTest::overlapTreatmentTest()
     }
 }
 
+template<class T>
+andres::View<T> subView
+(
+    andres::Marray<T>& m, 
+    std::initializer_list<std::size_t> base, 
+    std::initializer_list<std::size_t> shape
+)
+{
+    return m.view(base.begin(), shape.begin());
+}
+
+void ViewTest::exactOverlapTest()
+{
+    // interleaved but disjoint Views
+    {
+        andres::Marray<int> m({2, 5}, 0); // even and odd entries of a vector
+        andres::View<int> even = subView(m, {0, 0}, {1, 5});
+        andres::View<int> odd = subView(m, {1, 0}, {1, 5});
+        test(!even.overlaps(odd) && !odd.overlaps(even));
+        test(even.overlaps(even));
+        for(std::size_t j=0; j<5; ++j) {
+            odd(0, j) = static_cast<int>(j + 1);
+        }
+        even = odd;
+        for(std::size_t j=0; j<10; ++j) {
+            test(m(j) == static_cast<int>(j / 2 + 1));
+        }
+    }
+    {
+        andres::Marray<float> image({3, 4, 5}, 0.0f); // channels innermost
+        andres::View<float> red = subView(image, {0, 0, 0}, {1, 4, 5});
+        andres::View<float> green = subView(image, {1, 0, 0}, {1, 4, 5});
+        andres::View<float> crop = subView(image, {0, 1, 1}, {1, 2, 2});
+        test(!red.overlaps(green) && !green.overlaps(red));
+        test(red.overlaps(crop) && !green.overlaps(crop));
+    }
+    {
+        andres::Marray<int> m({8, 8}, 0); // left and right halves
+        andres::View<int> left = subView(m, {0, 0}, {4, 8});
+        andres::View<int> right = subView(m, {4, 0}, {4, 8});
+        andres::View<int> middle = subView(m, {3, 0}, {2, 8});
+        test(!left.overlaps(right) && !right.overlaps(left));
+        test(left.overlaps(middle) && right.overlaps(middle));
+    }
+    {
+        andres::Marray<int> m({4}, 0); // Views of different types
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(&m(1));
+        andres::View<unsigned char> v({sizeof(int)}, bytes);
+        test(v.overlaps(subView(m, {1}, {1})) && subView(m, {1}, {1}).overlaps(v));
+        test(!v.overlaps(subView(m, {0}, {1})) && !v.overlaps(subView(m, {2}, {2})));
+    }
+
+    // overlapping Views, shifted in memory
+    for(std::size_t backward=0; backward<2; ++backward) {
+        andres::Marray<int> m({10}, 0);
+        for(std::size_t j=0; j<10; ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        const std::size_t a = backward;
+        andres::View<int> v = subView(m, {a}, {9});
+        andres::View<int> w = subView(m, {1 - a}, {9});
+        v = w;
+        for(std::size_t j=0; j<9; ++j) {
+            test(v(j) == static_cast<int>(backward == 0 ? j + 1 : j));
+        }
+    }
+    for(std::size_t backward=0; backward<2; ++backward) {
+        andres::Marray<int> m({6, 7}, 0);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j * j % 23);
+        }
+        const andres::Marray<int> n = m;
+        const std::size_t a = (backward == 0 ? 0 : 1);
+        const std::size_t b = 1 - a;
+        andres::View<int> v = subView(m, {a, a}, {5, 6});
+        andres::View<int> w = subView(m, {b, b}, {5, 6});
+        v += w;
+        for(std::size_t x=0; x<5; ++x)
+        for(std::size_t y=0; y<6; ++y) {
+            test(m(x + a, y + a) == n(x + a, y + a) + n(x + b, y + b));
+        }
+    }
+    {
+        // overlapping Views with different strides require a copy
+        andres::Marray<int> m({4, 4}, 0);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        const andres::Marray<int> n = m;
+        andres::View<int> v = m;
+        v = m.transposedView();
+        for(std::size_t x=0; x<4; ++x)
+        for(std::size_t y=0; y<4; ++y) {
+            test(m(x, y) == n(y, x));
+        }
+    }
+}
+
+void ViewTest::inPlaceExpressionTest()
+{
+    andres::Marray<int> m({6, 7}, 0);
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<int>(j * j % 23);
+    }
+    const andres::Marray<int> n = m;
+    andres::View<int> v = subView(m, {1, 1}, {5, 6});
+    andres::View<int> w = subView(m, {0, 0}, {5, 6});
+    test(!v.overlapsOtherEntries(subView(m, {1, 1}, {5, 6})));
+    test(v.overlapsOtherEntries(w) && w.overlapsOtherEntries(v));
+    test(m.overlapsOtherEntries(m.transposedView()));
+    test(!m.overlapsOtherEntries(m) && m.overlaps(m));
+    test(!v.overlapsOtherEntries(subView(m, {0, 0}, {1, 1})));
+
+    // entry by entry, in place, i.e. without a temporary copy
+    {
+        andres::Marray<int, CountingAllocator<std::size_t> > a = n;
+        numberOfAllocations() = 0;
+        a = a * 2 + n;
+        test(numberOfAllocations() == 0);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(a(j) == 3 * n(j));
+        }
+        andres::Marray<int, CountingAllocator<std::size_t> > b({7, 7}, 1);
+        numberOfAllocations() = 0;
+        b = b - b.transposedView(); // other entries require a copy
+        test(numberOfAllocations() != 0);
+    }
+    m = m * 2 + n;
+    for(std::size_t j=0; j<m.size(); ++j) {
+        test(m(j) == 3 * n(j));
+    }
+    m = n;
+    v = andres::where(v > 10, v - 10, v) + v;
+    for(std::size_t x=0; x<6; ++x)
+    for(std::size_t y=0; y<7; ++y) {
+        const int z = n(x, y);
+        test(m(x, y) == (x == 0 || y == 0 ? z : (z > 10 ? 2 * z - 10 : 2 * z)));
+    }
+
+    // other entries require a copy
+    m = n;
+    v = v + w;
+    for(std::size_t x=0; x<5; ++x)
+    for(std::size_t y=0; y<6; ++y) {
+        test(m(x + 1, y + 1) == n(x + 1, y + 1) + n(x, y));
+    }
+    andres::Marray<int> s({7, 7}, 0);
+    for(std::size_t j=0; j<s.size(); ++j) {
+        s(j) = static_cast<int>(j);
+    }
+    const andres::Marray<int> t = s;
+    s = s - s.transposedView();
+    for(std::size_t x=0; x<7; ++x)
+    for(std::size_t y=0; y<7; ++y) {
+        test(s(x, y) == t(x, y) - t(y, x));
+    }
+    s = t;
+    s = s.boundView(1, 0) * s; // broadcast along the first dimension
+    for(std::size_t x=0; x<7; ++x)
+    for(std::size_t y=0; y<7; ++y) {
+        test(s(x, y) == t(y, 0) * t(x, y));
+    }
+}
+
+void ViewTest::scratchMemoryTest()
+{
+    test(andres::scratchCapacity() == std::size_t(1) << 26);
+
+    // freed blocks are re-used for temporaries of similar size
+    {
+        andres::marray_detail::ScratchAllocator<double> allocator;
+        double* p = allocator.allocate(100);
+        allocator.deallocate(p, 100);
+        double* q = allocator.allocate(90);
+        test(q == p);
+        allocator.deallocate(q, 90);
+    }
+
+    // blocks that cannot be cached are freed directly, also if the
+    // capacity is increased before they are freed
+    {
+        andres::setScratchCapacity(1024);
+        andres::marray_detail::ScratchAllocator<double> allocator;
+        double* p = allocator.allocate(200);
+        std::fill(p, p + 200, 1.0);
+        andres::setScratchCapacity(std::size_t(1) << 26);
+        allocator.deallocate(p, 200);
+        double* q = allocator.allocate(200);
+        std::fill(q, q + 200, 2.0);
+        allocator.deallocate(q, 200);
+    }
+
+    // temporaries of overlapping operands, also of more dimensions than 
+    // are stored inline
+    for(std::size_t capacity=0; capacity<2; ++capacity) {
+        andres::setScratchCapacity(capacity == 0 ? 0 : std::size_t(1) << 26);
+        for(std::size_t repetition=0; repetition<3; ++repetition) {
+            andres::Marray<int> s({5, 5}, 0);
+            for(std::size_t j=0; j<s.size(); ++j) {
+                s(j) = static_cast<int>(j);
+            }
+            const andres::Marray<int> t = s;
+            s += s.transposedView();
+            for(std::size_t x=0; x<5; ++x)
+            for(std::size_t y=0; y<5; ++y) {
+                test(s(x, y) == t(x, y) + t(y, x));
+            }
+            s = t;
+            s = s - s.transposedView() * 2;
+            for(std::size_t x=0; x<5; ++x)
+            for(std::size_t y=0; y<5; ++y) {
+                test(s(x, y) == t(x, y) - 2 * t(y, x));
+            }
+
+            std::vector<std::size_t> shape(10, 2);
+            andres::Marray<int> m(shape.begin(), shape.end(), 0);
+            for(std::size_t j=0; j<m.size(); ++j) {
+                m(j) = static_cast<int>(j);
+            }
+            const andres::Marray<int> n = m;
+            andres::View<int> v = m;
+            v = m.transposedView() + 1;
+            andres::View<int, true> w = n.transposedView();
+            for(std::size_t j=0; j<m.size(); ++j) {
+                test(v(j) == w(j) + 1);
+            }
+            m.resize({2, 2, 2, 2, 2, 2, 2, 2, 2, 3}, 7);
+            for(std::size_t j=0; j<1024; ++j) {
+                test(m(j) == w(j) + 1);
+            }
+            test(m(1024) == 7);
+        }
+    }
+    andres::setScratchCapacity(std::size_t(1) << 26);
+}
+
 void ViewTest::compatibilityFunctionsTest()
 {
     #ifdef MARRAY_COMPATIBILITY
@@ -11211,6 +11847,110 @@ void MarrayTest::assignmentOperatorTest(){
     }
 }
 
+void MarrayTest::moveTest() {
+    static_assert(std::is_nothrow_move_constructible<andres::Marray<int> >::value, "");
+    static_assert(std::is_nothrow_move_assignable<andres::Marray<int> >::value, "");
+    static_assert(std::is_nothrow_move_constructible<andres::View<int> >::value, "");
+    static_assert(std::is_nothrow_move_assignable<andres::View<int, true> >::value, "");
+
+    std::size_t shape[] = {3, 4, 2};
+    // move construction of Marray
+    {
+        andres::Marray<int> m(shape, shape + 3);
+        for(std::size_t j = 0; j < m.size(); ++j) {
+            m(j) = data_[j];
+        }
+        int* address = &m(0);
+        andres::Marray<int> n(std::move(m));
+        test(&n(0) == address);
+        test(n.dimension() == 3 && n.size() == 24);
+        for(std::size_t j = 0; j < n.size(); ++j) {
+            test(n(j) == data_[j]);
+        }
+        test(m.size() == 0);
+
+        // a moved-from Marray can be assigned to
+        m = n;
+        test(m.size() == 24 && &m(0) != address);
+        for(std::size_t j = 0; j < m.size(); ++j) {
+            test(m(j) == data_[j]);
+        }
+    }
+    // move assignment of Marray
+    {
+        andres::Marray<int> m(shape, shape + 3, 1);
+        andres::Marray<int> n(shape, shape + 2, 2, andres::FirstMajorOrder);
+        int* address = &m(0);
+        n = std::move(m);
+        test(&n(0) == address);
+        test(n.dimension() == 3 && n.size() == 24);
+        test(n.coordinateOrder() == andres::defaultOrder);
+        test(n(2, 3, 1) == 1);
+        test(m.size() == 0);
+
+        n = andres::Marray<int>(shape, shape + 2, 3);
+        test(n.dimension() == 2 && n.size() == 12 && n(2, 3) == 3);
+    }
+    // swap of Marrays
+    {
+        andres::Marray<int> m(shape, shape + 3, 1);
+        andres::Marray<int> n(shape, shape + 2, 2);
+        int* addressM = &m(0);
+        int* addressN = &n(0);
+        swap(m, n);
+        test(&m(0) == addressN && m.dimension() == 2 && m(0, 0) == 2);
+        test(&n(0) == addressM && n.dimension() == 3 && n(0, 0, 0) == 1);
+        std::swap(m, n);
+        test(&m(0) == addressM && m.dimension() == 3);
+        test(&n(0) == addressN && n.dimension() == 2);
+    }
+    // Marrays in a std::vector are moved, not copied, on re-allocation
+    {
+        std::vector<andres::Marray<int> > vector;
+        vector.push_back(andres::Marray<int>(shape, shape + 3, 5));
+        int* address = &vector[0](0);
+        for(std::size_t j = 0; j < 10; ++j) {
+            vector.push_back(andres::Marray<int>(shape, shape + 1, static_cast<int>(j)));
+        }
+        test(&vector[0](0) == address);
+        test(vector[0].size() == 24 && vector[0](23) == 5);
+        test(vector[10].size() == 3 && vector[10](2) == 9);
+    }
+    // move construction and assignment of View
+    {
+        andres::View<int> v(shape, shape + 3, data_);
+        andres::View<int> w(std::move(v));
+        test(&w(0) == data_ && w.dimension() == 3);
+
+        // an un-initialized View takes over the geometry
+        andres::View<int> x;
+        x = std::move(w);
+        test(&x(0) == data_ && x.dimension() == 3 && x(2, 3, 1) == data_[23]);
+
+        // an initialized View on mutable data copies the data
+        andres::Marray<int> m(shape, shape + 3, 0);
+        andres::View<int> y = m;
+        y = std::move(x);
+        test(&y(0) == &m(0));
+        for(std::size_t j = 0; j < m.size(); ++j) {
+            test(m(j) == data_[j]);
+        }
+
+        // a View on constant data takes over the geometry
+        andres::View<int, true> c(shape, shape + 2, data2x_);
+        andres::View<int, true> d(c);
+        c = andres::View<int, true>(shape, shape + 3, data_);
+        test(&c(0) == data_ && c.dimension() == 3);
+        test(&d(0) == data2x_ && d.dimension() == 2);
+    }
+    // a View constructed from a temporary Marray does not take its data
+    {
+        andres::Marray<int> m(shape, shape + 3, 7);
+        andres::View<int> v(static_cast<andres::Marray<int>&&>(m));
+        test(m.size() == 24 && &v(0) == &m(0));
+    }
+}
+
 void MarrayTest::reshapeTest() {
     // 2D 
     {
@@ -12076,9 +12816,1583 @@ class Cpp0xTest {
 };
 #endif
 
+struct Axpy {
+    Axpy(const float a)
+        : a_(a), count_(0) {}
+    void operator()(float& y, const float& x)
+        { y = a_ * x + y; ++count_; }
+    float a_;
+    std::size_t count_;
+};
+
+struct Clamp {
+    double operator()(const int& x, const short& lower, const double& upper) const
+        { return x < lower ? lower : (x > upper ? upper : x); }
+};
+
+template<class T>
+void MathFunctionTest::elementaryFunctionsTest()
+{
+    const T tolerance = 8 * std::numeric_limits<T>::epsilon();
+    for(std::size_t size=1; size<150; size+=13) {
+        andres::Marray<T> a({size, 3}, static_cast<T>(0));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            a(j) = static_cast<T>(0.173) * (static_cast<T>(j % 101) - static_cast<T>(50));
+        }
+        andres::Marray<T> b({size, 3}, static_cast<T>(0));
+
+        // contiguous
+        b = andres::exp(a);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(std::abs(b(j) - std::exp(a(j))) <= tolerance * std::exp(a(j)));
+        }
+        b = andres::log(andres::abs(a) + static_cast<T>(1));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            const T y = std::log(std::abs(a(j)) + static_cast<T>(1));
+            test(std::abs(b(j) - y) <= tolerance * y);
+        }
+        b = andres::sqrt(andres::abs(a)) + andres::floor(a) - andres::ceil(a * static_cast<T>(2));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == std::sqrt(std::abs(a(j))) + std::floor(a(j)) - std::ceil(a(j) * static_cast<T>(2)));
+        }
+        b = andres::minimum(a, static_cast<T>(1)) * andres::maximum(static_cast<T>(-2), a);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == std::min(a(j), static_cast<T>(1)) * std::max(static_cast<T>(-2), a(j)));
+        }
+        b = andres::pow(andres::abs(a), static_cast<T>(1.5));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == std::pow(std::abs(a(j)), static_cast<T>(1.5)));
+        }
+
+        // strided, and broadcast along the second dimension
+        andres::Marray<T> c({3}, static_cast<T>(0));
+        c(0) = static_cast<T>(-1);
+        c(1) = static_cast<T>(0.5);
+        c(2) = static_cast<T>(2);
+        andres::View<T> v = a.boundView(1, 1);
+        andres::Marray<T> d = andres::exp(andres::minimum(a, c));
+        andres::Marray<T> e = andres::log(andres::abs(v) + static_cast<T>(1));
+        for(std::size_t j=0; j<size; ++j)
+        for(std::size_t k=0; k<3; ++k) {
+            const T y = std::exp(std::min(a(j, k), c(k)));
+            test(std::abs(d(j, k) - y) <= tolerance * y);
+        }
+        for(std::size_t j=0; j<size; ++j) {
+            const T y = std::log(std::abs(a(j, 1)) + static_cast<T>(1));
+            test(std::abs(e(j) - y) <= tolerance * y);
+        }
+    }
+}
+
+template<class T>
+void MathFunctionTest::specialValuesTest()
+{
+    const T infinity = std::numeric_limits<T>::infinity();
+    const T values[] = {
+        static_cast<T>(0), -static_cast<T>(0), static_cast<T>(1), static_cast<T>(-1),
+        infinity, -infinity, std::numeric_limits<T>::quiet_NaN(),
+        std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::min(), 
+        std::numeric_limits<T>::max(), static_cast<T>(88.5), static_cast<T>(-103.5), 
+        static_cast<T>(709.5), static_cast<T>(-745.5), static_cast<T>(0.5), 
+        static_cast<T>(-2.5), static_cast<T>(-1e7), static_cast<T>(8388607.5)
+    };
+    const std::size_t size = sizeof(values) / sizeof(T);
+    andres::Marray<T> a({size}, static_cast<T>(0));
+    std::copy(values, values + size, a.begin());
+    andres::Marray<T> b({size}, static_cast<T>(0));
+
+    const T tolerance = 8 * std::numeric_limits<T>::epsilon();
+    b = andres::exp(a);
+    for(std::size_t j=0; j<size; ++j) {
+        const T y = std::exp(a(j));
+        if(std::isnan(y)) {
+            test(std::isnan(b(j)));
+        }
+        else if(std::isinf(y) || y == 0) {
+            test(b(j) == y);
+        }
+        else {
+            test(std::abs(b(j) - y) <= tolerance * y);
+        }
+    }
+    b = andres::log(a);
+    for(std::size_t j=0; j<size; ++j) {
+        const T y = std::log(a(j));
+        if(std::isnan(y)) {
+            test(std::isnan(b(j)));
+        }
+        else if(std::isinf(y) || y == 0) {
+            test(b(j) == y);
+        }
+        else {
+            test(std::abs(b(j) - y) <= tolerance * std::abs(y));
+        }
+    }
+    b = andres::floor(a);
+    for(std::size_t j=0; j<size; ++j) {
+        const T y = std::floor(a(j));
+        test(std::isnan(y) ? std::isnan(b(j)) 
+            : b(j) == y && std::signbit(b(j)) == std::signbit(y));
+    }
+    b = andres::ceil(a);
+    for(std::size_t j=0; j<size; ++j) {
+        const T y = std::ceil(a(j));
+        test(std::isnan(y) ? std::isnan(b(j)) 
+            : b(j) == y && std::signbit(b(j)) == std::signbit(y));
+    }
+    b = andres::abs(a);
+    for(std::size_t j=0; j<size; ++j) {
+        test(std::isnan(a(j)) ? std::isnan(b(j)) 
+            : b(j) == std::abs(a(j)) && !std::signbit(b(j)));
+    }
+}
+
+void MathFunctionTest::integerTest()
+{
+    andres::Marray<int> a({4, 37}, 0);
+    andres::Marray<int> b({4, 37}, 0);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        a(j) = static_cast<int>(j % 23) - 11;
+        b(j) = static_cast<int>(j % 7) - 3;
+    }
+    andres::Marray<int> c = andres::maximum(andres::abs(a), b) - andres::minimum(3, a * b);
+    andres::Marray<int> d = andres::pow(b, 2) + andres::floor(a) + andres::sqrt(andres::abs(b));
+    for(std::size_t j=0; j<a.size(); ++j) {
+        test(c(j) == std::max(std::abs(a(j)), b(j)) - std::min(3, a(j) * b(j)));
+        test(d(j) == b(j) * b(j) + a(j) + static_cast<int>(std::sqrt(std::abs(b(j)))));
+    }
+}
+
+template<class T>
+void MaskTest::comparisonTest()
+{
+    for(std::size_t size=1; size<100; size+=11) {
+        andres::Marray<T> a({size, 3}, static_cast<T>(0));
+        andres::Marray<T> b({size, 3}, static_cast<T>(0));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            a(j) = static_cast<T>(static_cast<int>(j % 13) - 6);
+            b(j) = static_cast<T>(static_cast<int>(j % 5) - 2);
+        }
+        andres::Marray<bool> m({size, 3}, false);
+
+        m = a < b;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (a(j) < b(j)));
+        }
+        m = a <= b;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (a(j) <= b(j)));
+        }
+        m = a > b;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (a(j) > b(j)));
+        }
+        m = a >= static_cast<T>(1);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (a(j) >= static_cast<T>(1)));
+        }
+        m = static_cast<T>(1) == b;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (b(j) == static_cast<T>(1)));
+        }
+        m = a * b != a + b;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (a(j) * b(j) != a(j) + b(j)));
+        }
+
+        // comparison in the promoted type
+        m = a < 0.5;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(m(j) == (static_cast<double>(a(j)) < 0.5));
+        }
+
+        // strided, and broadcast along the first dimension
+        andres::View<T> v = a.boundView(1, 2);
+        andres::Marray<bool> n = v > andres::abs(v) - static_cast<T>(1);
+        for(std::size_t j=0; j<size; ++j) {
+            test(n(j) == (a(j, 2) > std::abs(a(j, 2)) - static_cast<T>(1)));
+        }
+        andres::Marray<T> c({3}, static_cast<T>(0));
+        c(1) = static_cast<T>(2);
+        c(2) = static_cast<T>(-3);
+        m = a == c;
+        for(std::size_t j=0; j<size; ++j)
+        for(std::size_t k=0; k<3; ++k) {
+            test(m(j, k) == (a(j, k) == c(k)));
+        }
+    }
+}
+
+template<class T>
+void MaskTest::whereTest()
+{
+    for(std::size_t size=1; size<100; size+=11) {
+        andres::Marray<T> a({size, 3}, static_cast<T>(0));
+        andres::Marray<T> b({size, 3}, static_cast<T>(0));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            a(j) = static_cast<T>(static_cast<int>(j % 13) - 6);
+            b(j) = static_cast<T>(static_cast<int>(j % 5) - 2);
+        }
+        andres::Marray<T> c({size, 3}, static_cast<T>(0));
+
+        c = andres::where(a < b, a, b);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(c(j) == std::min(a(j), b(j)));
+        }
+        c = andres::where(a > static_cast<T>(0), a * b, static_cast<T>(0));
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(c(j) == (a(j) > 0 ? a(j) * b(j) : 0));
+        }
+        c = andres::where(a != b, static_cast<T>(1), -b);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(c(j) == (a(j) != b(j) ? 1 : -b(j)));
+        }
+        c = andres::where(a <= b, static_cast<T>(1), static_cast<T>(2)) + a;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(c(j) == (a(j) <= b(j) ? 1 : 2) + a(j));
+        }
+
+        // mask of bool
+        andres::Marray<bool> m = a >= b;
+        c = andres::where(m, b, a);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(c(j) == std::min(a(j), b(j)));
+        }
+
+        // promoted type
+        andres::Marray<double> d = andres::where(a < b, a, 0.5);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(d(j) == (a(j) < b(j) ? static_cast<double>(a(j)) : 0.5));
+        }
+
+        // strided, and broadcast mask and operands
+        andres::View<T> v = a.boundView(1, 0);
+        andres::Marray<T> e = andres::where(v < static_cast<T>(0), -v, v);
+        for(std::size_t j=0; j<size; ++j) {
+            test(e(j) == std::abs(a(j, 0)));
+        }
+        andres::Marray<T> f({3}, static_cast<T>(0));
+        f(0) = static_cast<T>(-1);
+        f(2) = static_cast<T>(4);
+        c = andres::where(f > static_cast<T>(0), a, f);
+        for(std::size_t j=0; j<size; ++j)
+        for(std::size_t k=0; k<3; ++k) {
+            test(c(j, k) == (f(k) > 0 ? a(j, k) : f(k)));
+            test(andres::where(a < f, f, b)(j, k) == (a(j, k) < f(k) ? f(k) : b(j, k)));
+        }
+    }
+}
+
+void MaskTest::countAnyAllTest()
+{
+    andres::Marray<float> a({7, 5, 3}, 0.0f);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        a(j) = static_cast<float>(j % 17) - 8.0f;
+    }
+    std::size_t n = 0;
+    for(std::size_t j=0; j<a.size(); ++j) {
+        n += a(j) > 2.0f;
+    }
+    test(andres::count(a > 2.0f) == n);
+    test(andres::count(a) == a.size() - std::count(a.begin(), a.end(), 0.0f));
+    test(andres::any(a > 7.0f));
+    test(!andres::any(a > 8.0f));
+    test(andres::all(a >= -8.0f));
+    test(!andres::all(a > -8.0f));
+    test(andres::all(andres::where(a < 0.0f, -a, a) == andres::abs(a)));
+
+    // strided
+    andres::View<float> v = a.boundView(2, 1);
+    n = 0;
+    for(std::size_t j=0; j<v.size(); ++j) {
+        n += v(j) < 0.0f;
+    }
+    test(andres::count(v < 0.0f) == n);
+    test(andres::any(v == v(4, 3)));
+    test(!andres::any(v != v));
+    test(andres::all(v == v));
+
+    // entries that are found in the middle and at the end
+    andres::Marray<int> b({1000, 3}, 0);
+    test(!andres::any(b));
+    test(andres::all(b == 0));
+    b(999, 2) = 1;
+    test(andres::any(b));
+    test(andres::any(b.boundView(1, 2)));
+    test(!andres::any(b.boundView(1, 1)));
+    test(andres::count(b.boundView(1, 2)) == 1);
+    b(500, 0) = 1;
+    test(!andres::all(b == 0));
+    test(andres::count(b != 0) == 2);
+
+    // parallel
+    andres::setNumberOfThreads(4);
+    andres::setParallelThreshold(64);
+    test(andres::any(b));
+    test(andres::any(b.boundView(1, 0)));
+    test(!andres::all(b.boundView(1, 0) == 0));
+    test(andres::all(b.boundView(1, 1) == 0));
+    test(andres::count(b) == 2);
+    andres::setNumberOfThreads(1);
+    andres::setParallelThreshold(1 << 18);
+}
+
+void Float16Test::conversionTest()
+{
+    // every Float16 is represented exactly as a float
+    for(std::uint32_t j=0; j<65536; ++j) {
+        const andres::Float16 h = andres::Float16::fromBits(static_cast<std::uint16_t>(j));
+        const float x = h;
+        if(std::isnan(x)) {
+            test((j & 0x7c00u) == 0x7c00u && (j & 0x03ffu) != 0);
+            test(std::isnan(static_cast<float>(andres::Float16(x))));
+        }
+        else {
+            test(andres::Float16(x).bits() == j);
+        }
+    }
+    test(andres::Float16(1.0f).bits() == 0x3c00u);
+    test(andres::Float16(-2.0f).bits() == 0xc000u);
+    test(andres::Float16(0.1f).bits() == 0x2e66u);
+    test(andres::Float16(65504.0f).bits() == 0x7bffu);
+    test(andres::Float16(65519.0f).bits() == 0x7bffu);
+    test(andres::Float16(65520.0f).bits() == 0x7c00u); // rounded to infinity
+    test(andres::Float16(std::ldexp(1.0f, -24)).bits() == 0x0001u);
+    test(andres::Float16(std::ldexp(1.0f, -25)).bits() == 0x0000u); // tie to even
+    test(andres::Float16(std::ldexp(3.0f, -26)).bits() == 0x0001u);
+    test(andres::Float16(std::ldexp(3.0f, -25)).bits() == 0x0002u); // tie to even
+    test(andres::Float16(1.0f + std::ldexp(1.0f, -11)).bits() == 0x3c00u); // tie to even
+    test(andres::Float16(1.0f + std::ldexp(3.0f, -11)).bits() == 0x3c02u); // tie to even
+    test(andres::Float16(-0.0f).bits() == 0x8000u);
+
+    test(andres::BFloat16(1.0f).bits() == 0x3f80u);
+    test(andres::BFloat16(-3.0f).bits() == 0xc040u);
+    test(andres::BFloat16(1.0f + std::ldexp(1.0f, -8)).bits() == 0x3f80u); // tie to even
+    test(andres::BFloat16(1.0f + std::ldexp(3.0f, -8)).bits() == 0x3f82u); // tie to even
+    test(andres::BFloat16(std::numeric_limits<float>::max()).bits() == 0x7f80u);
+    test(std::isnan(static_cast<float>(andres::BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    for(std::uint32_t j=0; j<65536; ++j) {
+        const andres::BFloat16 h = andres::BFloat16::fromBits(static_cast<std::uint16_t>(j));
+        const float x = h;
+        test(std::isnan(x) || andres::BFloat16(x).bits() == j);
+    }
+}
+
+// the conversion of contiguous Views agrees with the conversion of scalars
+template<class H>
+void Float16Test::viewConversionTest()
+{
+    for(std::size_t size=1; size<100; size+=9) {
+        andres::Marray<float> a({size, 3}, 0.0f);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            const int exponent = static_cast<int>(j % 61) - 30;
+            a(j) = std::ldexp(1.0f + static_cast<float>(j % 1021) / 1021.0f, exponent);
+            if(j % 3 == 0) {
+                a(j) = -a(j);
+            }
+        }
+        andres::Marray<H> h(a);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(h(j).bits() == H(a(j)).bits());
+        }
+        andres::Marray<float> b(h);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == static_cast<float>(h(j)));
+        }
+        b = 0.0f;
+        andres::View<float> t = b.transposedView();
+        t = h.transposedView();
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == static_cast<float>(h(j)));
+        }
+        andres::Marray<H> g({size, 3}, H(0.0f));
+        g = a;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(g(j).bits() == h(j).bits());
+        }
+    }
+}
+
+template<class H>
+void Float16Test::arithmeticTest()
+{
+    andres::Marray<H> x({40, 3}, H(0.0f));
+    andres::Marray<H> y({40, 3}, H(0.0f));
+    for(std::size_t j=0; j<x.size(); ++j) {
+        x(j) = static_cast<float>(j % 17) * 0.25f;
+        y(j) = static_cast<float>(j % 5) - 2.0f;
+    }
+
+    // expressions are evaluated in float
+    andres::Marray<float> z = x * y + 1.0f;
+    test((std::is_same<typename decltype(x * y)::value_type, float>::value));
+    test((std::is_same<typename decltype(x * 2)::value_type, float>::value));
+    test((std::is_same<typename decltype(x * 2.0)::value_type, double>::value));
+    for(std::size_t j=0; j<x.size(); ++j) {
+        test(z(j) == static_cast<float>(x(j)) * static_cast<float>(y(j)) + 1.0f);
+    }
+    andres::Marray<H> w = andres::where(x > y, x - y, y);
+    for(std::size_t j=0; j<x.size(); ++j) {
+        const float a = x(j);
+        const float b = y(j);
+        test(w(j).bits() == H(a > b ? a - b : b).bits());
+    }
+
+    // compound assignment
+    andres::Marray<H> v = x;
+    v += y;
+    v *= 2.0f;
+    ++v;
+    for(std::size_t j=0; j<x.size(); ++j) {
+        const float a = H(static_cast<float>(x(j)) + static_cast<float>(y(j)));
+        test(v(j).bits() == H(static_cast<float>(H(a * 2.0f)) + 1.0f).bits());
+    }
+
+    // sums are accumulated in float
+    andres::Marray<H> ones({4096, 3}, H(1.0f));
+    test(static_cast<float>(andres::sum(ones)) == 12288.0f);
+    test(static_cast<float>(andres::squaredNorm(ones)) == 12288.0f);
+}
+
+template<andres::CoordinateOrder coordinateOrder>
+void FixedRankTest::viewTest()
+{
+    int data[60];
+    for(int j = 0; j < 60; ++j) {
+        data[j] = j;
+    }
+    const std::size_t shape[] = {3, 4, 5};
+    andres::View<int> v(shape, shape + 3, data, coordinateOrder);
+
+    // construction from shape and conversion from View
+    andres::FixedRankView<int, 3> f({3, 4, 5}, data, coordinateOrder);
+    andres::FixedRankView<int, 3> g(v);
+    test(f.dimension() == 3 && f.size() == 60 && f.coordinateOrder() == coordinateOrder);
+    for(std::size_t j = 0; j < 3; ++j) {
+        test(f.shape(j) == v.shape(j) && f.strides(j) == v.strides(j));
+        test(g.shape(j) == v.shape(j) && g.strides(j) == v.strides(j));
+    }
+    for(std::size_t x = 0; x < 3; ++x)
+    for(std::size_t y = 0; y < 4; ++y)
+    for(std::size_t z = 0; z < 5; ++z) {
+        test(&f(x, y, z) == &v(x, y, z));
+        test(&g(x, y, z) == &v(x, y, z));
+    }
+    f(2, 1, 3) = 100;
+    test(v(2, 1, 3) == 100);
+
+    // sub-views
+    andres::FixedRankView<int, 3, true> c = f.view({1, 2, 1}, {2, 2, 3});
+    andres::View<int> w = v.view(std::vector<std::size_t>({1, 2, 1}).begin(), 
+        std::vector<std::size_t>({2, 2, 3}).begin());
+    test(c.size() == 12);
+    for(std::size_t x = 0; x < 2; ++x)
+    for(std::size_t y = 0; y < 2; ++y)
+    for(std::size_t z = 0; z < 3; ++z) {
+        test(&c(x, y, z) == &w(x, y, z));
+    }
+    andres::FixedRankView<int, 2> b = f.boundView(1, 2);
+    andres::View<int> u = v.boundView(1, 2);
+    test(b.shape(0) == 3 && b.shape(1) == 5);
+    for(std::size_t x = 0; x < 3; ++x)
+    for(std::size_t z = 0; z < 5; ++z) {
+        test(&b(x, z) == &u(x, z));
+    }
+    andres::FixedRankView<int, 3> t = f.transposedView(0, 2);
+    test(t.shape(0) == 5 && t.shape(2) == 3);
+    test(&t(3, 1, 2) == &f(2, 1, 3));
+
+    // conversion to View
+    andres::View<int> r = t;
+    andres::View<int, true> s = c;
+    test(r.dimension() == 3 && r.coordinateOrder() == coordinateOrder);
+    test(&r(3, 1, 2) == &f(2, 1, 3));
+    test(s.size() == 12 && &s(1, 1, 2) == &c(1, 1, 2));
+    test(r.isSimple() == false && f.asView().isSimple() == true);
+    andres::Marray<int> m = f.asView() * 2;
+    test(m(2, 1, 3) == 200 && m(0, 0, 0) == 0);
+}
+
+void FixedRankTest::marrayTest()
+{
+    typedef andres::FixedRankMarray<float, 2> Matrix;
+
+    Matrix a({3, 4}, 1.0f);
+    test(a.size() == 12 && a(2, 3) == 1.0f);
+    for(std::size_t x = 0; x < 3; ++x)
+    for(std::size_t y = 0; y < 4; ++y) {
+        a(x, y) = static_cast<float>(x * 10 + y);
+    }
+
+    // copy and move
+    Matrix b = a;
+    test(&b(0, 0) != &a(0, 0) && b(2, 3) == 23.0f);
+    float* address = &b(0, 0);
+    Matrix c = std::move(b);
+    test(&c(0, 0) == address && c(1, 2) == 12.0f);
+    test(b.size() == 0);
+    b = c;
+    test(b.size() == 12 && b(2, 1) == 21.0f);
+    Matrix d;
+    d = std::move(c);
+    test(&d(0, 0) == address && c.size() == 0);
+
+    // expressions, also in place
+    Matrix e(a.asView() + b.asView());
+    test(e(2, 3) == 46.0f);
+    e = e.asView() * 2.0f - a.asView();
+    test(e(2, 3) == 69.0f && e(1, 1) == 33.0f);
+    e = a.asView() - 1.0f;
+    test(e(0, 0) == -1.0f);
+
+    // assignment of an expression of a different shape re-allocates
+    andres::Marray<float> m({2, 5}, 3.0f);
+    e = m + 1.0f;
+    test(e.shape(0) == 2 && e.shape(1) == 5 && e(1, 4) == 4.0f);
+
+    // copy from a View, resize
+    Matrix f(m);
+    test(f.shape(1) == 5 && f(1, 3) == 3.0f);
+    f.resize({5, 2}, 2.0f);
+    test(f.shape(0) == 5 && f(4, 1) == 2.0f);
+    f.resize({4, 4});
+    test(f.size() == 16 && f.shape(0) == 4);
+}
+
+void FixedShapeTest::constructionAndAssignmentTest()
+{
+    typedef andres::FixedShapeMarray<float, 3, 3> Tensor;
+
+    Tensor a(1.0f);
+    test(a.dimension() == 2 && a.size() == 9);
+    test(a.shape(0) == 3 && a.shape(1) == 3 && a.isSimple());
+    for(std::size_t x = 0; x < 3; ++x)
+    for(std::size_t y = 0; y < 3; ++y) {
+        test(a(x, y) == 1.0f);
+        a(x, y) = static_cast<float>(x * 3 + y);
+    }
+    test(reinterpret_cast<const char*>(&a(0)) >= reinterpret_cast<const char*>(&a)
+        && reinterpret_cast<const char*>(&a(8)) < reinterpret_cast<const char*>(&a + 1));
+
+    // copies own their entries
+    Tensor b = a;
+    test(&b(0) != &a(0) && b(2, 1) == 7.0f);
+    b(2, 1) = 0.0f;
+    test(a(2, 1) == 7.0f);
+    Tensor c = std::move(b);
+    test(&c(0) != &b(0) && c(2, 1) == 0.0f);
+    b = a;
+    test(b(2, 1) == 7.0f && &b(0) != &a(0));
+    std::vector<Tensor> tensors(5, a);
+    tensors.push_back(c);
+    test(tensors[0](2, 1) == 7.0f && tensors[5](2, 1) == 0.0f);
+    test(&tensors[5](0) == &tensors[5](0, 0));
+}
+
+void FixedShapeTest::arithmeticOperatorsTest()
+{
+    typedef andres::FixedShapeMarray<float, 3, 3> Tensor;
+
+    Tensor a(0.0f);
+    for(std::size_t j = 0; j < 9; ++j) {
+        a(j / 3, j % 3) = static_cast<float>(j);
+    }
+    const Tensor b = a;
+    Tensor d = a + b * 2.0f;
+    test(d(2, 1) == 21.0f && d(0, 0) == 0.0f);
+    d = d - a;
+    test(d(2, 1) == 14.0f);
+    d += 1.0f;
+    test(d(2, 1) == 15.0f);
+    andres::Marray<float> m = d * d;
+    test(m.dimension() == 2 && m(2, 1) == 225.0f);
+    test(andres::sum(a) == 36.0f);
+    d = 2.0f;
+    test(d(1, 1) == 2.0f);
+}
+
+void FixedShapeTest::viewTest()
+{
+    andres::FixedShapeMarray<float, 3, 3> a(0.0f);
+    for(std::size_t j = 0; j < 9; ++j) {
+        a(j / 3, j % 3) = static_cast<float>(j);
+    }
+    andres::View<float> row = a.boundView(0, 1);
+    test(row.size() == 3 && row(2) == a(1, 2));
+    andres::FixedShapeMarray<int, 4, 4> t(0, andres::FirstMajorOrder);
+    for(std::size_t j = 0; j < 4; ++j) {
+        t(j, j) = 1;
+    }
+    t(0, 3) = 5;
+    test(t.coordinateOrder() == andres::FirstMajorOrder && t(3) == 5);
+    andres::FixedShapeMarray<int, 4, 4> u = t.transposedView();
+    test(u(3, 0) == 5 && u(0, 3) == 0);
+    andres::Marray<float> n({2, 3}, 1.5f);
+    andres::FixedShapeMarray<double, 2, 3> e(n);
+    test(e(1, 2) == 1.5);
+}
+
+void AlignmentTest::alignedAllocatorTest()
+{
+    typedef andres::AlignedAllocator<std::size_t, 64> Allocator;
+    typedef andres::AlignedAllocator<std::size_t, 4096> PageAllocator;
+
+    for(std::size_t n = 1; n < 40; n += 3) {
+        andres::Marray<float, Allocator> m({n, 3}, 1.0f);
+        andres::Marray<char, PageAllocator> p({n}, 'a');
+        test(reinterpret_cast<std::uintptr_t>(&m(0)) % 64 == 0);
+        test(reinterpret_cast<std::uintptr_t>(&p(0)) % 4096 == 0);
+        test(m(n - 1, 2) == 1.0f && p(n - 1) == 'a');
+        m.resize({n + 1, 5}, 2.0f);
+        test(reinterpret_cast<std::uintptr_t>(&m(0)) % 64 == 0);
+        test(m(n - 1, 2) == 1.0f && m(n, 4) == 2.0f);
+    }
+
+    // interoperability with arrays of the default allocator
+    andres::Marray<double, Allocator> a({5, 7}, 2.0);
+    andres::Marray<double> b({5, 7}, 3.0);
+    a = a + b;
+    andres::Marray<double, Allocator> c = a * b;
+    test(c(4, 6) == 15.0 && reinterpret_cast<std::uintptr_t>(&c(0)) % 64 == 0);
+    andres::Marray<double, Allocator> d = c;
+    test(d(4, 6) == 15.0 && &d(0) != &c(0));
+    test(Allocator() == andres::AlignedAllocator<float, 64>());
+}
+
+template<andres::CoordinateOrder coordinateOrder>
+void AlignmentTest::paddedMarrayTest()
+{
+    typedef andres::PaddedMarray<float, 64> Array;
+    const std::size_t fastest = (coordinateOrder == andres::FirstMajorOrder) ? 2 : 0;
+
+    Array a({5, 3, 7}, 1.0f, coordinateOrder);
+    test(a.dimension() == 3 && a.size() == 105 && !a.isSimple());
+    test(a.shape(0) == 5 && a.shape(1) == 3 && a.shape(2) == 7);
+    test(a.coordinateOrder() == coordinateOrder);
+    test(a.strides(fastest) == 1);
+    test(a.pitch() == 16);
+    for(std::size_t x = 0; x < 5; ++x)
+    for(std::size_t y = 0; y < 3; ++y)
+    for(std::size_t z = 0; z < 7; ++z) {
+        test(a(x, y, z) == 1.0f);
+        a(x, y, z) = static_cast<float>(x * 100 + y * 10 + z);
+        if((fastest == 0 && x == 0) || (fastest == 2 && z == 0)) {
+            // every row starts at an aligned address
+            test(reinterpret_cast<std::uintptr_t>(&a(x, y, z)) % 64 == 0);
+        }
+    }
+
+    // expressions, also with Marrays
+    andres::Marray<float> m({5, 3, 7}, 1.0f, coordinateOrder);
+    Array b = a + m;
+    test(b.pitch() == 16 && b(4, 2, 6) == 427.0f);
+    b *= 2.0f;
+    b = b - a;
+    test(b(4, 2, 6) == 428.0f);
+    andres::Marray<float> c = b;
+    test(c.isSimple() && c(4, 2, 6) == 428.0f);
+    test(andres::sum(a) == andres::sum(andres::Marray<float>(a)));
+
+    // copy and move
+    Array d = b;
+    test(&d(0) != &b(0) && d(3, 1, 2) == b(3, 1, 2));
+    const float* address = &d(0);
+    Array e = std::move(d);
+    test(&e(0) == address && e(4, 2, 6) == 428.0f);
+    d = e;
+    test(&d(0) != address && d(4, 2, 6) == 428.0f);
+    Array f;
+    f = std::move(e);
+    test(&f(0) == address);
+    Array g(m.boundView(1, 2));
+    test(g.dimension() == 2 && g(4, 6) == 1.0f);
+
+    // assignment to un-initialized PaddedMarrays and to PaddedMarrays of 
+    // a different shape allocates padded memory
+    Array h;
+    h = m;
+    test(&h(0) != &m(0) && h.pitch() == 16 && h(4, 2, 6) == 1.0f);
+    test(reinterpret_cast<std::uintptr_t>(&h(0)) % 64 == 0);
+    Array i = std::move(h);
+    test(i(4, 2, 6) == 1.0f);
+    h = c; // moved-from
+    test(&h(0) != &c(0) && h.pitch() == 16 && h(4, 2, 6) == 428.0f);
+    h = m.boundView(1, 2);
+    test(h.dimension() == 2 && h(4, 6) == 1.0f);
+    Array k;
+    k = andres::Marray<float>({2, 3}, 5.0f, coordinateOrder);
+    test(k.size() == 6 && k(1, 2) == 5.0f);
+    k = a + m;
+    test(k.dimension() == 3 && k.pitch() == 16 && k(4, 2, 6) == 427.0f);
+    k = k.boundView(0, 4); // overlapping
+    test(k.dimension() == 2 && k(2, 6) == 427.0f);
+    k = 3.0f;
+    test(k(0, 0) == 3.0f && k(2, 6) == 3.0f);
+}
+
+void ForEachTest::forEachTest()
+{
+    // simple
+    {
+        andres::Marray<float> x({5, 4, 3}, 0.0f);
+        andres::Marray<float> y({5, 4, 3}, 1.0f);
+        for(std::size_t j=0; j<x.size(); ++j) {
+            x(j) = static_cast<float>(j);
+        }
+        Axpy functor = andres::forEach(Axpy(2.0f), y, x);
+        test(functor.count_ == y.size());
+        for(std::size_t j=0; j<y.size(); ++j) {
+            test(y(j) == 2.0f * x(j) + 1.0f);
+        }
+    }
+    // strided Views of different layouts
+    {
+        andres::Marray<float> x({6, 5, 4}, 0.0f, andres::FirstMajorOrder);
+        andres::Marray<float> y({4, 5, 6}, 1.0f);
+        for(std::size_t j=0; j<x.size(); ++j) {
+            x(j) = static_cast<float>(j);
+        }
+        std::size_t base[] = {1, 0, 1};
+        std::size_t shape[] = {4, 5, 3};
+        andres::View<float, true> u = x.constView(base, shape);
+        andres::View<float> v = y.transposedView().view(base, shape);
+        Axpy functor = andres::forEach(Axpy(3.0f), v, u);
+        test(functor.count_ == v.size());
+        for(std::size_t a=0; a<6; ++a)
+        for(std::size_t b=0; b<5; ++b)
+        for(std::size_t c=0; c<4; ++c) {
+            if(a >= 1 && a < 5 && c >= 1) {
+                test(y(c, b, a) == 3.0f * x(a, b, c) + 1.0f);
+            }
+            else {
+                test(y(c, b, a) == 1.0f);
+            }
+        }
+    }
+    // scalar Views
+    {
+        andres::Marray<float> x(2.0f);
+        andres::Marray<float> y(1.0f);
+        andres::forEach(Axpy(3.0f), y, x);
+        test(y(0) == 7.0f);
+    }
+}
+
+void ForEachTest::transformTest()
+{
+    andres::Marray<int> x({7, 6}, 0);
+    andres::Marray<short> lower({7, 6}, 3);
+    andres::Marray<double> upper({6, 7}, 20.0);
+    for(std::size_t j=0; j<x.size(); ++j) {
+        x(j) = static_cast<int>(j);
+    }
+    andres::Marray<double> out({7, 6}, 0.0, andres::FirstMajorOrder);
+    andres::transform(out, Clamp(), x, lower, upper.transposedView());
+    for(std::size_t a=0; a<7; ++a)
+    for(std::size_t b=0; b<6; ++b) {
+        test(out(a, b) == std::min(std::max(x(a, b), 3), 20));
+    }
+
+    // in place
+    andres::Marray<double> y({7, 6}, 30.0);
+    andres::transform(y, Clamp(), x, lower, y);
+    for(std::size_t j=0; j<y.size(); ++j) {
+        test(y(j) == std::min(std::max(x(j), 3), 30));
+    }
+}
+
+void BroadcastTest::broadcastedViewTest()
+{
+    andres::Marray<int> bias({3}, 0);
+    bias(0) = 1; bias(1) = 2; bias(2) = 3;
+    andres::View<int> v = bias.broadcastedView({4, 3});
+    test(v.dimension() == 2 && v.shape(0) == 4 && v.shape(1) == 3 && v.size() == 12);
+    test(v.strides(0) == 0 && v.strides(1) == 1);
+    test(!v.isSimple());
+    for(std::size_t x=0; x<4; ++x)
+    for(std::size_t y=0; y<3; ++y) {
+        test(v(x, y) == bias(y));
+    }
+
+    // singleton dimensions
+    andres::Marray<int> column({4, 1}, 0);
+    for(std::size_t x=0; x<4; ++x) {
+        column(x, 0) = static_cast<int>(x);
+    }
+    andres::View<int> w = column.broadcastedView({2, 4, 5});
+    test(w.dimension() == 3 && w.size() == 40);
+    for(std::size_t t=0; t<2; ++t)
+    for(std::size_t x=0; x<4; ++x)
+    for(std::size_t y=0; y<5; ++y) {
+        test(w(t, x, y) == static_cast<int>(x));
+    }
+}
+
+template<andres::CoordinateOrder coordinateOrder>
+void BroadcastTest::compoundAssignmentTest()
+{
+    // per-column bias of an [N, C] matrix
+    {
+        std::size_t shape[] = {5, 3};
+        andres::Marray<float> m(shape, shape + 2, 1.0f, coordinateOrder);
+        andres::Marray<float> bias({3}, 0.0f, coordinateOrder);
+        bias(0) = 1.0f; bias(1) = 2.0f; bias(2) = 3.0f;
+        m += bias;
+        m *= bias;
+        for(std::size_t n=0; n<5; ++n)
+        for(std::size_t c=0; c<3; ++c) {
+            test(m(n, c) == (1.0f + bias(c)) * bias(c));
+        }
+    }
+    // per-channel normalization of an image stack [T, Y, X, C]
+    {
+        std::size_t shape[] = {2, 3, 4, 3};
+        andres::Marray<double> m(shape, shape + 4, 0.0, coordinateOrder);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<double>(j);
+        }
+        const andres::Marray<double> original = m;
+        std::size_t channelShape[] = {1, 1, 3};
+        andres::Marray<double> offset(channelShape, channelShape + 3, 0.0, coordinateOrder);
+        andres::Marray<double> scale(channelShape, channelShape + 3, 0.0, coordinateOrder);
+        for(std::size_t c=0; c<3; ++c) {
+            offset(0, 0, c) = static_cast<double>(c);
+            scale(0, 0, c) = static_cast<double>(c + 1);
+        }
+        std::size_t base[] = {0, 1, 0, 0};
+        std::size_t viewShape[] = {2, 2, 4, 3};
+        andres::View<double> v = m.view(base, viewShape);
+        v -= offset;
+        v /= scale;
+        for(std::size_t t=0; t<2; ++t)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t x=0; x<4; ++x)
+        for(std::size_t c=0; c<3; ++c) {
+            if(y == 0) {
+                test(m(t, y, x, c) == original(t, y, x, c));
+            }
+            else {
+                test(m(t, y, x, c) == (original(t, y, x, c) - c) / (c + 1));
+            }
+        }
+    }
+    // broadcast of a row of the destination itself
+    {
+        std::size_t shape[] = {4, 3};
+        andres::Marray<int> m(shape, shape + 2, 0, coordinateOrder);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        const andres::Marray<int> original = m;
+        m -= m.boundView(0, 2);
+        for(std::size_t n=0; n<4; ++n)
+        for(std::size_t c=0; c<3; ++c) {
+            test(m(n, c) == original(n, c) - original(2, c));
+        }
+    }
+}
+
+template<andres::CoordinateOrder coordinateOrder>
+void BroadcastTest::expressionTest()
+{
+    std::size_t shape[] = {4, 5, 3};
+    andres::Marray<int> a(shape, shape + 3, 0, coordinateOrder);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        a(j) = static_cast<int>(j % 7);
+    }
+    std::size_t rowShape[] = {5, 1};
+    andres::Marray<int> row(rowShape, rowShape + 2, 0, coordinateOrder);
+    andres::Marray<int> channel({3}, 0, coordinateOrder);
+    for(std::size_t y=0; y<5; ++y) {
+        row(y, 0) = static_cast<int>(y + 1);
+    }
+    for(std::size_t c=0; c<3; ++c) {
+        channel(c) = static_cast<int>(10 * c);
+    }
+
+    // Marray from a broadcasting expression
+    andres::Marray<int> b = a * row + channel;
+    test(b.dimension() == 3);
+    test(b.shape(0) == 4 && b.shape(1) == 5 && b.shape(2) == 3);
+    for(std::size_t x=0; x<4; ++x)
+    for(std::size_t y=0; y<5; ++y)
+    for(std::size_t c=0; c<3; ++c) {
+        test(b(x, y, c) == a(x, y, c) * row(y, 0) + channel(c));
+        test((a * row + channel)(x, y, c) == b(x, y, c));
+    }
+    for(std::size_t j=0; j<b.size(); ++j) {
+        test((a * row + channel)(j) == b(j));
+    }
+
+    // both operands broadcast
+    andres::Marray<int> c = row + channel;
+    test(c.dimension() == 2 && c.shape(0) == 5 && c.shape(1) == 3);
+    for(std::size_t y=0; y<5; ++y)
+    for(std::size_t k=0; k<3; ++k) {
+        test(c(y, k) == row(y, 0) + channel(k));
+    }
+
+    // broadcasting expressions in compound assignment and reductions
+    andres::Marray<int> d = a;
+    std::size_t base[] = {1, 0, 0};
+    std::size_t viewShape[] = {3, 5, 3};
+    andres::View<int> v = d.view(base, viewShape);
+    v = v + 2 * channel;
+    int s = 0;
+    for(std::size_t x=0; x<4; ++x)
+    for(std::size_t y=0; y<5; ++y)
+    for(std::size_t k=0; k<3; ++k) {
+        test(d(x, y, k) == a(x, y, k) + (x == 0 ? 0 : 20 * static_cast<int>(k)));
+        s += a(x, y, k) - row(y, 0);
+    }
+    test(andres::sum(a - row) == s);
+
+    // expression of lower dimension assigned to a View
+    v = 3 * channel;
+    for(std::size_t x=0; x<4; ++x)
+    for(std::size_t y=0; y<5; ++y)
+    for(std::size_t k=0; k<3; ++k) {
+        test(d(x, y, k) == (x == 0 ? a(x, y, k) : 30 * static_cast<int>(k)));
+    }
+}
+
+void ReductionTest::reductionTest()
+{
+    // simple
+    {
+        andres::Marray<int> m({5, 7, 3}, 0);
+        int s = 0;
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>((j * 37) % 101) - 50;
+            s += m(j);
+        }
+        test(andres::sum(m) == s);
+        test(andres::mean(m) == s / static_cast<int>(m.size()));
+        test(andres::min(m) == *std::min_element(m.begin(), m.end()));
+        test(andres::max(m) == *std::max_element(m.begin(), m.end()));
+        int squares = 0;
+        for(std::size_t j=0; j<m.size(); ++j) {
+            squares += m(j) * m(j);
+        }
+        test(andres::squaredNorm(m) == squares);
+        test(andres::dot(m, m) == squares);
+    }
+    // not simple
+    {
+        andres::Marray<float> m({6, 9, 4}, 0.0f);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<float>((j * 13) % 29);
+        }
+        std::size_t base[] = {1, 2, 1};
+        std::size_t shape[] = {4, 5, 3};
+        andres::View<float> v = m.view(base, shape);
+        andres::View<float> w = v.transposedView();
+        float s = 0.0f;
+        float squares = 0.0f;
+        float minimum = v(0);
+        float maximum = v(0);
+        for(std::size_t j=0; j<v.size(); ++j) {
+            s += v(j);
+            squares += v(j) * v(j);
+            minimum = std::min(minimum, v(j));
+            maximum = std::max(maximum, v(j));
+        }
+        test(!v.isSimple());
+        test(andres::sum(v) == s && andres::sum(w) == s);
+        test(andres::min(v) == minimum && andres::min(w) == minimum);
+        test(andres::max(v) == maximum && andres::max(w) == maximum);
+        test(andres::mean(v) == s / static_cast<float>(v.size()));
+        test(andres::squaredNorm(w) == squares);
+        test(std::abs(andres::norm(v) - std::sqrt(squares)) < 1e-4f);
+    }
+    // scalar
+    {
+        andres::Marray<double> m(-3.0);
+        test(andres::sum(m) == -3.0 && andres::min(m) == -3.0 && andres::max(m) == -3.0);
+        test(andres::norm(m) == 3.0);
+    }
+}
+
+void ReductionTest::expressionReductionTest()
+{
+    andres::Marray<int> a({8, 6}, 0);
+    andres::Marray<int> b({8, 6}, 0);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        a(j) = static_cast<int>(j % 11);
+        b(j) = static_cast<int>((j * 5) % 7);
+    }
+    int squaredError = 0;
+    int s = 0;
+    int minimum = a(0) - 2 * b(0);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        squaredError += (a(j) - b(j)) * (a(j) - b(j));
+        s += a(j) - 2 * b(j);
+        minimum = std::min(minimum, a(j) - 2 * b(j));
+    }
+    test(andres::squaredNorm(a - b) == squaredError);
+    test(andres::sum((a - b) * (a - b)) == squaredError);
+    test(andres::dot(a - b, a - b) == squaredError);
+    test(andres::sum(a - 2 * b) == s);
+    test(andres::min(a - 2 * b) == minimum);
+    
+    // expressions that are not simple
+    std::size_t base[] = {1, 1};
+    std::size_t shape[] = {6, 4};
+    andres::View<int> v = a.view(base, shape);
+    andres::View<int> w = b.view(base, shape);
+    int maximum = v(0) + w(0);
+    s = 0;
+    for(std::size_t j=0; j<v.size(); ++j) {
+        s += v(j) * w(j);
+        maximum = std::max(maximum, v(j) + w(j));
+    }
+    test(andres::dot(v, w) == s);
+    test(andres::max(v + w) == maximum);
+    test(andres::max(-(v + w)) == -std::min(andres::min(v + w), maximum));
+
+    // rows longer than a vector, in both coordinate orders
+    for(std::size_t order=0; order<2; ++order) {
+        const andres::CoordinateOrder coordinateOrder = order == 0
+            ? andres::LastMajorOrder : andres::FirstMajorOrder;
+        andres::Marray<float> c({5, 43, 41}, 0.0f, coordinateOrder);
+        for(std::size_t j=0; j<c.size(); ++j) {
+            c(j) = static_cast<float>((j * 13) % 29) - 14.0f;
+        }
+        std::size_t cBase[] = {1, 2, 1};
+        std::size_t cShape[] = {3, 39, 37};
+        andres::View<float> x = c.view(cBase, cShape);
+        andres::Marray<float> y({3, 1, 37}, 0.0f, coordinateOrder);
+        for(std::size_t j=0; j<y.size(); ++j) {
+            y(j) = static_cast<float>(j % 3);
+        }
+        float expectedSum = 0.0f;
+        float expectedMinimum = x(0) * y(0);
+        float expectedMaximum = x(0);
+        for(std::size_t j=0; j<x.size(); ++j) {
+            std::size_t coordinate[3];
+            x.indexToCoordinates(j, coordinate);
+            const float z = x(j) * y(coordinate[0], 0, coordinate[2]);
+            expectedSum += x(j);
+            expectedMinimum = std::min(expectedMinimum, z);
+            expectedMaximum = std::max(expectedMaximum, x(j));
+        }
+        test(andres::sum(x) == expectedSum);
+        test(andres::sum(x + 0.0f) == expectedSum);
+        test(andres::max(x) == expectedMaximum);
+        test(andres::min(x * y.broadcastedView(x.shapeBegin(), x.shapeEnd())) == expectedMinimum);
+    }
+}
+
+template<class T, bool isConst>
+void testAxisReduction
+(
+    const andres::View<T, isConst>& v
+)
+{
+    for(std::size_t axis=0; axis<v.dimension(); ++axis) {
+        const andres::Marray<T> s = andres::sum(v, axis);
+        const andres::Marray<T> p = andres::reduce(v, axis, std::multiplies<T>());
+        const andres::Marray<T> minimum = andres::min(v, axis);
+        const andres::Marray<T> maximum = andres::max(v, axis);
+        const andres::Marray<T> m = andres::mean(v, axis);
+        const andres::Marray<std::size_t> argMinimum = andres::argmin(v, axis);
+        const andres::Marray<std::size_t> argMaximum = andres::argmax(v, axis);
+        test(s.dimension() == v.dimension() - 1);
+        test(s.coordinateOrder() == v.coordinateOrder());
+        for(std::size_t j=0; j<v.dimension(); ++j) {
+            if(j != axis) {
+                test(s.shape(j < axis ? j : j - 1) == v.shape(j));
+            }
+        }
+        std::vector<std::size_t> c(v.dimension());
+        std::vector<std::size_t> d(v.dimension() - 1);
+        for(std::size_t index=0; index<s.size(); ++index) {
+            s.indexToCoordinates(index, d.begin());
+            for(std::size_t j=0; j<d.size(); ++j) {
+                c[j < axis ? j : j + 1] = d[j];
+            }
+            c[axis] = 0;
+            T expectedSum = v(c.begin());
+            T expectedProduct = v(c.begin());
+            std::size_t expectedArgMinimum = 0;
+            std::size_t expectedArgMaximum = 0;
+            T expectedMinimum = v(c.begin());
+            T expectedMaximum = v(c.begin());
+            for(c[axis]=1; c[axis]<v.shape(axis); ++c[axis]) {
+                const T x = v(c.begin());
+                expectedSum += x;
+                expectedProduct *= x;
+                if(x < expectedMinimum) {
+                    expectedMinimum = x;
+                    expectedArgMinimum = c[axis];
+                }
+                if(x > expectedMaximum) {
+                    expectedMaximum = x;
+                    expectedArgMaximum = c[axis];
+                }
+            }
+            test(s(d.begin()) == expectedSum);
+            test(p(d.begin()) == expectedProduct);
+            test(minimum(d.begin()) == expectedMinimum);
+            test(maximum(d.begin()) == expectedMaximum);
+            test(m(d.begin()) == expectedSum / static_cast<T>(v.shape(axis)));
+            test(argMinimum(d.begin()) == expectedArgMinimum);
+            test(argMaximum(d.begin()) == expectedArgMaximum);
+        }
+    }
+}
+
+template<andres::CoordinateOrder coordinateOrder>
+void ReductionTest::axisReductionTest()
+{
+    std::size_t shape[] = {4, 5, 6};
+    andres::Marray<int> m(shape, shape + 3, 0, coordinateOrder);
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<int>((j * 17) % 13) - 6;
+    }
+    testAxisReduction(m);
+
+    // not simple
+    std::size_t base[] = {1, 0, 2};
+    std::size_t subShape[] = {3, 5, 3};
+    andres::View<int, true> v = m.constView(base, subShape);
+    testAxisReduction(v);
+    testAxisReduction(v.transposedView());
+
+    // one dimension
+    andres::Marray<double> w({7}, 0.0, coordinateOrder);
+    for(std::size_t j=0; j<w.size(); ++j) {
+        w(j) = static_cast<double>((j * 3) % 5);
+    }
+    andres::Marray<double> s = andres::sum(w, 0);
+    test(s.dimension() == 0 && s(0) == 13.0);
+    test(andres::argmax(w, 0)(0) == 3 && andres::argmin(w, 0)(0) == 0);
+    test(andres::max(w, 0)(0) == 4.0 && andres::min(w, 0)(0) == 0.0);
+    test(andres::mean(w, 0)(0) == 13.0 / 7.0);
+}
+
+ParallelExecutionTest::ParallelExecutionTest()
+{
+    andres::setNumberOfThreads(4);
+    andres::setParallelThreshold(0);
+}
+
+ParallelExecutionTest::~ParallelExecutionTest()
+{
+    andres::setNumberOfThreads(1);
+    andres::setParallelThreshold(1 << 18);
+}
+
+void ParallelExecutionTest::operateTest()
+{
+    test(andres::numberOfThreads() == 4);
+    test(andres::parallelThreshold() == 0);
+
+    // simple
+    {
+        andres::Marray<int> m({64, 32}, 1);
+        m += 2;
+        m *= 3;
+        ++m;
+        for(std::size_t j=0; j<m.size(); ++j) {
+            test(m(j) == 10);
+        }
+        m = 5;
+        for(std::size_t j=0; j<m.size(); ++j) {
+            test(m(j) == 5);
+        }
+    }
+
+    // strided, in both coordinate orders
+    for(std::size_t order=0; order<2; ++order) {
+        const andres::CoordinateOrder coordinateOrder = 
+            order == 0 ? andres::FirstMajorOrder : andres::LastMajorOrder;
+        andres::Marray<int> m({9, 7, 5}, 0, coordinateOrder);
+        andres::Marray<int> n({9, 7, 5}, 0, coordinateOrder);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+            n(j) = static_cast<int>(2 * j);
+        }
+        andres::Marray<int> original = m;
+        std::size_t base[] = {1, 2, 1};
+        std::size_t shape[] = {7, 4, 3};
+        andres::View<int> v = m.view(base, shape);
+        andres::View<int, true> w = n.constView(base, shape);
+        test(!v.isSimple());
+
+        v += w;
+        for(std::size_t x=0; x<9; ++x)
+        for(std::size_t y=0; y<7; ++y)
+        for(std::size_t z=0; z<5; ++z) {
+            if(x >= 1 && x < 8 && y >= 2 && y < 6 && z >= 1 && z < 4) {
+                test(m(x, y, z) == original(x, y, z) + n(x, y, z));
+            }
+            else {
+                test(m(x, y, z) == original(x, y, z));
+            }
+        }
+
+        v = 3;
+        v -= 1;
+        for(std::size_t j=0; j<v.size(); ++j) {
+            test(v(j) == 2);
+        }
+
+        // assignment from a View with a different coordinate order
+        andres::Marray<double> p(v.shapeBegin(), v.shapeEnd(), 0.0, 
+            order == 0 ? andres::LastMajorOrder : andres::FirstMajorOrder);
+        p = w;
+        test(p.coordinateOrder() == coordinateOrder);
+        andres::Marray<double> q(w);
+        for(std::size_t x=0; x<7; ++x)
+        for(std::size_t y=0; y<4; ++y)
+        for(std::size_t z=0; z<3; ++z) {
+            test(p(x, y, z) == w(x, y, z));
+            test(q(x, y, z) == w(x, y, z));
+        }
+    }
+
+    // more than 10 dimensions
+    {
+        std::vector<std::size_t> shape(11, 2);
+        shape[10] = 5;
+        andres::Marray<int> m(shape.begin(), shape.end(), 1);
+        andres::View<int> v = m.transposedView();
+        test(!v.isSimple());
+        v *= 7;
+        for(std::size_t j=0; j<m.size(); ++j) {
+            test(m(j) == 7);
+        }
+    }
+}
+
+void ParallelExecutionTest::expressionTest()
+{
+    andres::Marray<int> a({16, 12}, 0);
+    andres::Marray<int> b({16, 12}, 0);
+    for(std::size_t j=0; j<a.size(); ++j) {
+        a(j) = static_cast<int>(j);
+        b(j) = static_cast<int>(j % 7);
+    }
+
+    // simple
+    andres::Marray<int> c({16, 12}, 0);
+    c = a * 2 + b;
+    for(std::size_t j=0; j<c.size(); ++j) {
+        test(c(j) == a(j) * 2 + b(j));
+    }
+
+    // strided
+    andres::Marray<int> d({12, 16}, 0);
+    andres::View<int> t = d.transposedView();
+    t = a - b;
+    for(std::size_t x=0; x<16; ++x)
+    for(std::size_t y=0; y<12; ++y) {
+        test(d(y, x) == a(x, y) - b(x, y));
+    }
+    t += a;
+    for(std::size_t x=0; x<16; ++x)
+    for(std::size_t y=0; y<12; ++y) {
+        test(d(y, x) == 2 * a(x, y) - b(x, y));
+    }
+}
+
+// rows along the first dimension of sub-Views, contiguous, strided and
+// broadcast, of lengths that are not multiples of the vector length
+template<class T>
+void ParallelExecutionTest::rowExpressionTest()
+{
+    for(std::size_t size=1; size<40; size+=6) {
+        andres::Marray<T> a({size + 3, 5, 4}, static_cast<T>(0));
+        andres::Marray<T> b({size + 3, 5, 4}, static_cast<T>(0), andres::FirstMajorOrder);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            a(j) = static_cast<T>(j % 11);
+            b(j) = static_cast<T>(j % 7);
+        }
+        andres::Marray<T> c({size}, static_cast<T>(0));
+        for(std::size_t j=0; j<size; ++j) {
+            c(j) = static_cast<T>(j % 3);
+        }
+        std::size_t base[] = {2, 1, 0};
+        std::size_t shape[] = {size, 3, 4};
+        andres::View<T> u = a.view(base, shape);
+        andres::View<T> v = b.view(base, shape);
+        std::size_t baseW[] = {1, 0, 0};
+        andres::Marray<T> d({size + 1, 4, 4}, static_cast<T>(0));
+        andres::View<T> w = d.view(baseW, shape);
+
+        w = u * static_cast<T>(2) + u;
+        for(std::size_t x=0; x<size; ++x)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t z=0; z<4; ++z) {
+            test(d(x + 1, y, z) == a(x + 2, y + 1, z) * 3);
+        }
+        w = u - v; // strided rows of v
+        for(std::size_t x=0; x<size; ++x)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t z=0; z<4; ++z) {
+            test(d(x + 1, y, z) == a(x + 2, y + 1, z) - b(x + 2, y + 1, z));
+        }
+        w = andres::where(u < v, u, v);
+        for(std::size_t x=0; x<size; ++x)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t z=0; z<4; ++z) {
+            test(d(x + 1, y, z) == std::min(a(x + 2, y + 1, z), b(x + 2, y + 1, z)));
+        }
+
+        // rows along the last dimension of a FirstMajorOrder target
+        andres::Marray<T> g({size + 1, 4, 4}, static_cast<T>(0), andres::FirstMajorOrder);
+        andres::View<T> h = g.view(baseW, shape);
+        h = v * static_cast<T>(2) - u;
+        for(std::size_t x=0; x<size; ++x)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t z=0; z<4; ++z) {
+            test(g(x + 1, y, z) == b(x + 2, y + 1, z) * 2 - a(x + 2, y + 1, z));
+        }
+
+        // broadcast along the first dimension (stride 0)
+        andres::View<T> r = a.boundView(0, 0).boundView(0, 0);
+        w = u + r;
+        for(std::size_t x=0; x<size; ++x)
+        for(std::size_t y=0; y<3; ++y)
+        for(std::size_t z=0; z<4; ++z) {
+            test(d(x + 1, y, z) == a(x + 2, y + 1, z) + a(0, 0, z));
+        }
+        andres::Marray<T> e({size}, static_cast<T>(0));
+        andres::View<T> t = u.boundView(2, 1).boundView(1, 2);
+        e = t * c; // one strided row
+        for(std::size_t x=0; x<size; ++x) {
+            test(e(x) == a(x + 2, 3, 1) * c(x));
+        }
+    }
+}
+
+// sizes that are not multiples of the vector length test the remainder loops
+template<class T>
+void ContiguousKernelTest::arithmeticOperatorsTest()
+{
+    for(std::size_t size=1; size<150; size+=7) {
+        andres::Marray<T> a({size}, static_cast<T>(0));
+        andres::Marray<T> b({size}, static_cast<T>(0));
+        for(std::size_t j=0; j<size; ++j) {
+            a(j) = static_cast<T>(j % 13 + 1);
+            b(j) = static_cast<T>(j % 5 + 1);
+        }
+        std::vector<T> x(a.begin(), a.end());
+        std::vector<T> y(b.begin(), b.end());
+
+        a += b;
+        a *= b;
+        a -= static_cast<T>(2);
+        ++a;
+        a /= b;
+        for(std::size_t j=0; j<size; ++j) {
+            x[j] += y[j];
+            x[j] *= y[j];
+            x[j] -= static_cast<T>(2);
+            ++x[j];
+            x[j] /= y[j];
+            test(a(j) == x[j]);
+        }
+
+        a = b;
+        for(std::size_t j=0; j<size; ++j) {
+            test(a(j) == b(j));
+        }
+        a = static_cast<T>(3);
+        andres::Marray<T> c({size}, static_cast<T>(3));
+        for(std::size_t j=0; j<size; ++j) {
+            test(a(j) == static_cast<T>(3));
+            test(c(j) == static_cast<T>(3));
+        }
+        c.resize({size + 5}, static_cast<T>(4));
+        for(std::size_t j=0; j<size + 5; ++j) {
+            test(c(j) == static_cast<T>(j < size ? 3 : 4));
+        }
+    }
+}
+
+template<class T>
+void ContiguousKernelTest::streamingTest()
+{
+    andres::setStreamingThreshold(0);
+    test(andres::streamingThreshold() == 0);
+    for(std::size_t size=1; size<100; size+=9) {
+        // fill
+        andres::Marray<T> a({size}, static_cast<T>(7));
+        for(std::size_t j=0; j<size; ++j) {
+            test(a(j) == static_cast<T>(7));
+        }
+        a.resize({size + 3}, static_cast<T>(5));
+        for(std::size_t j=0; j<size + 3; ++j) {
+            test(a(j) == static_cast<T>(j < size ? 7 : 5));
+        }
+        a = static_cast<T>(2);
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(a(j) == static_cast<T>(2));
+        }
+
+        // copy, also from and to addresses that are not 16-byte aligned
+        for(std::size_t j=0; j<a.size(); ++j) {
+            a(j) = static_cast<T>(j % 17);
+        }
+        andres::Marray<T> b = a;
+        andres::Marray<T> c({1}, static_cast<T>(0));
+        c = a;
+        std::size_t base[] = {1};
+        std::size_t shape[] = {size + 1};
+        andres::View<T, true> u = a.constView(base, shape);
+        andres::Marray<T> d({size + 3}, static_cast<T>(0));
+        andres::View<T> v = d.view(base, shape);
+        v = u;
+        for(std::size_t j=0; j<a.size(); ++j) {
+            test(b(j) == a(j));
+            test(c(j) == a(j));
+            if(j >= 1 && j < size + 2) {
+                test(d(j) == a(j));
+            }
+        }
+        test(d(0) == static_cast<T>(0) && d(size + 2) == static_cast<T>(0));
+    }
+    andres::setStreamingThreshold(std::numeric_limits<std::size_t>::max());
+}
+
+void ForEachTest::traversalPlanTest()
+{
+    // the same crop of several frames
+    andres::Marray<float> video({4, 8, 3}, 0.0f);
+    andres::Marray<float> result({2, 8}, 0.0f);
+    for(std::size_t j=0; j<video.size(); ++j) {
+        video(j) = static_cast<float>(j);
+    }
+    std::size_t base[] = {1, 0, 0};
+    std::size_t shape[] = {2, 8, 1};
+    andres::View<float> crop = video.view(base, shape);
+    crop.squeeze();
+    {
+        andres::TraversalPlan<2> plan(result, crop);
+        test(plan.size() == 16);
+        test(plan.dimension() == 2);
+        test(plan.runLength() == 2);
+        test(plan.isContiguous());
+        test(plan.strides(0, 0) == 1 && plan.strides(1, 0) == 1);
+        test(plan.strides(0, 1) == 2 && plan.strides(1, 1) == 4);
+        for(std::size_t frame=0; frame<3; ++frame) {
+            Axpy f = plan.execute(Axpy(2.0f), &result(0), &crop(0) + frame * video.strides(2));
+            test(f.count_ == 16);
+        }
+        for(std::size_t x=0; x<2; ++x)
+        for(std::size_t y=0; y<8; ++y) {
+            float expected = 0.0f;
+            for(std::size_t frame=0; frame<3; ++frame) {
+                expected += 2.0f * video(x + 1, y, frame);
+            }
+            test(result(x, y) == expected);
+        }
+    }
+    // contiguous Views are traversed in a single loop
+    {
+        andres::Marray<int> a({3, 4, 5}, 1);
+        andres::Marray<int> b({3, 4, 5}, 2);
+        andres::TraversalPlan<2> plan(a, b);
+        test(plan.dimension() == 1);
+        test(plan.runLength() == 60);
+        test(plan.isContiguous());
+    }
+    // scalar
+    {
+        andres::Marray<float> a(1.0f);
+        andres::Marray<float> b(3.0f);
+        andres::TraversalPlan<2> plan(a, b);
+        test(plan.dimension() == 1 && plan.size() == 1);
+        plan.execute(Axpy(2.0f), &a(0), &b(0));
+        test(a(0) == 7.0f);
+    }
+}
+
+void ParallelExecutionTest::reductionTest()
+{
+    andres::Marray<long> m({64, 32, 3}, 0);
+    long s = 0;
+    long squares = 0;
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<long>((j * 7919) % 1009) - 500;
+        s += m(j);
+        squares += m(j) * m(j);
+    }
+    const long minimum = *std::min_element(m.begin(), m.end());
+    const long maximum = *std::max_element(m.begin(), m.end());
+    test(andres::sum(m) == s);
+    test(andres::min(m) == minimum && andres::max(m) == maximum);
+    test(andres::squaredNorm(m) == squares);
+
+    // not simple, split along the last dimension
+    std::size_t permutation[] = {2, 0, 1};
+    andres::View<long> v = m.permutedView(permutation);
+    test(!v.isSimple());
+    test(andres::sum(v) == s);
+    test(andres::min(v) == minimum && andres::max(v) == maximum);
+    test(andres::dot(v, v) == squares);
+    test(andres::sum(v - v) == 0);
+}
+
+void ParallelExecutionTest::axisReductionTest()
+{
+    std::size_t shape[] = {16, 9, 12};
+    andres::Marray<long> m(shape, shape + 3, 0);
+    for(std::size_t j=0; j<m.size(); ++j) {
+        m(j) = static_cast<long>((j * 7919) % 1009) - 500;
+    }
+    testAxisReduction(m);
+    std::size_t permutation[] = {2, 0, 1};
+    testAxisReduction(m.permutedView(permutation));
+}
+
+void ParallelExecutionTest::allocationTest()
+{
+    // chunk j of every operation is processed by the same thread
+    std::vector<std::thread::id> first(4);
+    std::vector<std::thread::id> second(4);
+    andres::marray_detail::parallelFor(4, [&](const std::size_t j) {
+        first[j] = std::this_thread::get_id();
+    });
+    andres::marray_detail::parallelFor(4, [&](const std::size_t j) {
+        second[j] = std::this_thread::get_id();
+    });
+    test(first == second);
+    test(first[0] == std::this_thread::get_id());
+
+    // initialization with and without huge pages
+    test(andres::hugePageThreshold() == std::numeric_limits<std::size_t>::max());
+    for(std::size_t hugePages=0; hugePages<2; ++hugePages) {
+        andres::setHugePageThreshold(hugePages == 0 
+            ? std::numeric_limits<std::size_t>::max() : 0);
+        std::size_t shape[] = {1024, 300};
+        andres::Marray<int> m(andres::SkipInitialization, shape, shape + 2);
+        for(std::size_t j=0; j<m.size(); ++j) {
+            m(j) = static_cast<int>(j);
+        }
+        andres::Marray<int> n(shape, shape + 2, 3);
+        n += m;
+        for(std::size_t j=0; j<n.size(); ++j) {
+            test(n(j) == static_cast<int>(j) + 3);
+        }
+        andres::Marray<int> c = m;
+        c.resize(andres::SkipInitialization, {1024, 400});
+        for(std::size_t j=0; j<m.size(); ++j) {
+            test(c(j) == m(j));
+        }
+        andres::Marray<double> d({600, 700}, 1.5);
+        test(andres::all(d == 1.5));
+    }
+    andres::setHugePageThreshold(std::numeric_limits<std::size_t>::max());
+}
+
 int main() 
 {
     { GlobalFunctionTest t; t.shapeStrideTest(); }
+    { GlobalFunctionTest t; t.coalesceDimensionsTest(); }
+    { GlobalFunctionTest t; t.orderDimensionsTest(); }
 
     { ViewTest t; t.coordinatesToOffsetTest<false>(); }
     { ViewTest t; t.coordinatesToOffsetTest<true>(); }
@@ -12123,11 +14437,19 @@ int main()
     { ViewTest t; t.shiftOperatorTest<true, andres::LastMajorOrder>(); }
     { ViewTest t; t.shiftOperatorTest<true, andres::FirstMajorOrder>(); } 
     { ViewTest t; t.arithmeticOperatorsTest(); }
+    { ViewTest t; t.subViewArithmeticTest<andres::LastMajorOrder>(); }
+    { ViewTest t; t.subViewArithmeticTest<andres::FirstMajorOrder>(); }
     { ViewTest t; t.asStringTest<true>(); } 
     { ViewTest t; t.asStringTest<false>(); } 
     { ViewTest t; t.reshapeTest(); }
     { ViewTest t; t.overlapTreatmentTest(); }
+    { ViewTest t; t.exactOverlapTest(); }
+    { ViewTest t; t.inPlaceExpressionTest(); }
+    { ViewTest t; t.scratchMemoryTest(); }
+    { ViewTest t; t.inlineGeometryTest(); }
     { ViewTest t; t.compatibilityFunctionsTest(); }
+    { ViewTest t; t.highDimensionalArithmeticTest(); }
+    { ViewTest t; t.permuteCopyTest(); }
 
     { IteratorTest t; t.constructorTest<false>(); }
     { IteratorTest t; t.constructorTest<true>(); }
@@ -12150,6 +14472,7 @@ int main()
     { MarrayTest t; t.copyConstructorTest<true>(); }
     { MarrayTest t; t.assignmentOperatorTest<false>(); }
     { MarrayTest t; t.assignmentOperatorTest<true>(); }
+    { MarrayTest t; t.moveTest(); }
     { MarrayTest t; t.reshapeTest(); } 
     { MarrayTest t; t.resizeTest<andres::LastMajorOrder>(); } 
     { MarrayTest t; t.resizeTest<andres::FirstMajorOrder>(); } 
@@ -12163,6 +14486,74 @@ int main()
     { DifferingTypesTest t; t.nonBasicTypesTest(); }
     { DifferingTypesTest t; t.typePromotionTest(); }
 
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<char>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<unsigned char>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<short>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<int>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<unsigned long>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<float>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<double>(); }
+    { ContiguousKernelTest t; t.arithmeticOperatorsTest<long double>(); }
+    { ContiguousKernelTest t; t.streamingTest<char>(); }
+    { ContiguousKernelTest t; t.streamingTest<short>(); }
+    { ContiguousKernelTest t; t.streamingTest<float>(); }
+    { ContiguousKernelTest t; t.streamingTest<double>(); }
+    { ContiguousKernelTest t; t.streamingTest<long double>(); }
+    { MathFunctionTest t; t.elementaryFunctionsTest<float>(); }
+    { MathFunctionTest t; t.elementaryFunctionsTest<double>(); }
+    { MathFunctionTest t; t.elementaryFunctionsTest<long double>(); }
+    { MathFunctionTest t; t.specialValuesTest<float>(); }
+    { MathFunctionTest t; t.specialValuesTest<double>(); }
+    { MathFunctionTest t; t.integerTest(); }
+    { MaskTest t; t.comparisonTest<int>(); }
+    { MaskTest t; t.comparisonTest<float>(); }
+    { MaskTest t; t.comparisonTest<double>(); }
+    { MaskTest t; t.comparisonTest<long double>(); }
+    { MaskTest t; t.whereTest<short>(); }
+    { MaskTest t; t.whereTest<int>(); }
+    { MaskTest t; t.whereTest<float>(); }
+    { MaskTest t; t.whereTest<double>(); }
+    { MaskTest t; t.whereTest<long double>(); }
+    { MaskTest t; t.countAnyAllTest(); }
+    { Float16Test t; t.conversionTest(); }
+    { Float16Test t; t.viewConversionTest<andres::Float16>(); }
+    { Float16Test t; t.viewConversionTest<andres::BFloat16>(); }
+    { Float16Test t; t.arithmeticTest<andres::Float16>(); }
+    { Float16Test t; t.arithmeticTest<andres::BFloat16>(); }
+    { FixedRankTest t; t.viewTest<andres::LastMajorOrder>(); }
+    { FixedRankTest t; t.viewTest<andres::FirstMajorOrder>(); }
+    { FixedRankTest t; t.marrayTest(); }
+    { FixedShapeTest t; t.constructionAndAssignmentTest(); }
+    { FixedShapeTest t; t.arithmeticOperatorsTest(); }
+    { FixedShapeTest t; t.viewTest(); }
+    { AlignmentTest t; t.alignedAllocatorTest(); }
+    { AlignmentTest t; t.paddedMarrayTest<andres::LastMajorOrder>(); }
+    { AlignmentTest t; t.paddedMarrayTest<andres::FirstMajorOrder>(); }
+
+    { ForEachTest t; t.forEachTest(); }
+    { ForEachTest t; t.transformTest(); }
+    { ForEachTest t; t.traversalPlanTest(); }
+
+    { BroadcastTest t; t.broadcastedViewTest(); }
+    { BroadcastTest t; t.compoundAssignmentTest<andres::FirstMajorOrder>(); }
+    { BroadcastTest t; t.compoundAssignmentTest<andres::LastMajorOrder>(); }
+    { BroadcastTest t; t.expressionTest<andres::FirstMajorOrder>(); }
+    { BroadcastTest t; t.expressionTest<andres::LastMajorOrder>(); }
+
+    { ReductionTest t; t.reductionTest(); }
+    { ReductionTest t; t.expressionReductionTest(); }
+    { ReductionTest t; t.axisReductionTest<andres::FirstMajorOrder>(); }
+    { ReductionTest t; t.axisReductionTest<andres::LastMajorOrder>(); }
+
+    { ParallelExecutionTest t; t.operateTest(); }
+    { ParallelExecutionTest t; t.expressionTest(); }
+    { ParallelExecutionTest t; t.rowExpressionTest<int>(); }
+    { ParallelExecutionTest t; t.rowExpressionTest<float>(); }
+    { ParallelExecutionTest t; t.rowExpressionTest<double>(); }
+    { ParallelExecutionTest t; t.reductionTest(); }
+    { ParallelExecutionTest t; t.axisReductionTest(); }
+    { ParallelExecutionTest t; t.allocationTest(); }
+
     #ifdef HAVE_CPP0X_INITIALIZER_LISTS
     { Cpp0xTest t; t.test(); }
     #endif